@@ -6,6 +6,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <neuro/neuro.hpp>
 #include <vector>
 
@@ -16,11 +17,11 @@ const std::vector<std::pair<neuro::neuro_layer_t, float>> DATASET = {
     {{1.0f, 1.0f}, 0.0f},
 };
 
-float evaluateIndividual(const neuro::IIndividual& individual) {
+float evaluateNetwork(const neuro::INeuralNetwork& network) {
   float totalError = 0.0f;
 
   for (const auto& [input, expected] : DATASET) {
-    float output = individual.feedforward(input)[0];
+    float output = network.feedforward(input)[0];
     float error = expected - output;
 
     totalError += error * error;
@@ -31,29 +32,29 @@ float evaluateIndividual(const neuro::IIndividual& individual) {
 
 int main() {
   std::vector<int> structure = {2, 4, 1};
-  neuro::ActivationFunction activation = neuro::makeSigmoid();
+  neuro::ActivationFunction activation = neuro::maker::activationSigmoid();
 
-  neuro::Population population(POPULATION_SIZE, structure, activation);
+  auto population = std::make_shared<neuro::Population>(POPULATION_SIZE, structure, activation);
 
-  population.randomizeWeights(-5, 5);
-  population.randomizeBiases(-5, 5);
+  population->randomizeWeights(-5, 5);
+  population->randomizeBiases(-5, 5);
 
-  for (int generation = 0; generation <= GENERATIONS; ++generation) {
-    for (const auto& individual : population) {
-      float fitness = evaluateIndividual(*individual);
+  neuro::GeneticTrainer trainer(population, MUTATION_RATE, MUTATION_STRENGTH, ELITE_COUNT);
 
-      individual->setFitness(fitness);
-    }
+  for (int generation = 0; generation <= GENERATIONS; ++generation) {
+    population->evaluateFitness(evaluateNetwork);
 
-    const auto& best = population.getBestIndividual();
+    const auto& best = population->getBestIndividual();
     float bestFitness = best.getFitness();
 
     std::cout << "Generation " << std::setw(3) << generation << " | Best fitness: " << std::fixed << std::setprecision(6) << bestFitness << std::endl;
 
-    // population.evolve(MUTATION_RATE, MUTATION_STRENGTH, ELITE_COUNT);
+    if (generation < GENERATIONS) {
+      trainer.evolve();
+    }
   }
 
-  const auto& best = population.getBestIndividual();
+  const auto& best = population->getBestIndividual();
 
   std::cout << std::endl
             << "Best individual (XOR):" << std::endl;
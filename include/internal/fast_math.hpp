@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "internal/attribute.hpp"
+
+namespace neuro {
+
+  namespace fast_math {
+
+    constexpr float EXP_MIN = -87.33f;
+    constexpr float EXP_MAX = 88.37f;
+    constexpr float LOG2E = 1.44269504088896341f;
+    constexpr float LN2 = 0.693147180559945309f;
+    constexpr float LN2_HI = 0.693359375f;
+    constexpr float LN2_LO = -2.12194440e-4f;
+    constexpr float SQRT2_MINUS_ONE = 0.414213562373095049f;
+
+    constexpr float EXP_P0 = 1.9875691500e-4f;
+    constexpr float EXP_P1 = 1.3981999507e-3f;
+    constexpr float EXP_P2 = 8.3334519073e-3f;
+    constexpr float EXP_P3 = 4.1665795894e-2f;
+    constexpr float EXP_P4 = 1.6666665459e-1f;
+    constexpr float EXP_P5 = 5.0000001201e-1f;
+
+    // Cephes-style range reduction to |r| <= ln2 / 2 with a degree 6 minimax polynomial; relative error
+    // below 2 ulp on [EXP_MIN, EXP_MAX], inputs outside are clamped.
+    FORCE_INLINE float exp(float x) {
+      x = std::min(std::max(x, EXP_MIN), EXP_MAX);
+
+      const int32_t exponent = static_cast<int32_t>(x * LOG2E + (x >= 0 ? 0.5f : -0.5f));
+      const float n = static_cast<float>(exponent);
+      const float r = x - n * LN2_HI - n * LN2_LO;
+
+      float p = EXP_P0;
+      p = p * r + EXP_P1;
+      p = p * r + EXP_P2;
+      p = p * r + EXP_P3;
+      p = p * r + EXP_P4;
+      p = p * r + EXP_P5;
+
+      const float y = p * r * r + r + 1.0f;
+      const int32_t bits = (exponent + 127) << 23;
+
+      float scale;
+      std::memcpy(&scale, &bits, sizeof(scale));
+
+      return y * scale;
+    }
+
+    // log(1 + t) for t in [0, 1] through 2 * atanh(s) with s reduced to |s| <= 0.172.
+    FORCE_INLINE float log1pUnit(float t) {
+      const bool halve = t > SQRT2_MINUS_ONE;
+      const float s = halve ? (t - 1.0f) / (t + 3.0f) : t / (t + 2.0f);
+      const float s2 = s * s;
+
+      float p = 1.0f / 9.0f;
+      p = p * s2 + 1.0f / 7.0f;
+      p = p * s2 + 1.0f / 5.0f;
+      p = p * s2 + 1.0f / 3.0f;
+      p = p * s2 + 1.0f;
+
+      return 2.0f * s * p + (halve ? LN2 : 0.0f);
+    }
+
+    FORCE_INLINE float sigmoid(float x) {
+      return 1.0f / (1.0f + exp(-x));
+    }
+
+    FORCE_INLINE float tanh(float x) {
+      const float magnitude = 1.0f - 2.0f / (1.0f + exp(2.0f * std::fabs(x)));
+
+      return std::copysign(magnitude, x);
+    }
+
+    FORCE_INLINE float elu(float x) {
+      return x >= 0 ? x : exp(x) - 1.0f;
+    }
+
+    FORCE_INLINE float swish(float x) {
+      return x / (1.0f + exp(-x));
+    }
+
+    FORCE_INLINE float softplus(float x) {
+      return std::max(x, 0.0f) + log1pUnit(exp(-std::fabs(x)));
+    }
+
+  } // namespace fast_math
+
+} // namespace neuro
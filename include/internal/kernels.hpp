@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "internal/attribute.hpp"
+#include "neuro/utils/activation.hpp"
+#include "neuro/utils/simd.hpp"
+
+namespace neuro {
+
+  namespace kernel {
+
+    // output[i] = bias[i] + dot(weights[i * stride .. i * stride + cols], input)
+    //
+    // Vector paths reorder the summation, so against gemvScalar each output may differ by at most
+    // (cols + 1) * FLT_EPSILON * (|bias[i]| + sum_j |weights[i][j] * input[j]|).
+    typedef void (*gemv_fn)(const float* weights, size_t stride, size_t rows, size_t cols, const float* input, const float* bias, float* output);
+
+    // outputs[s * rows + i] = bias[i] + dot(weights row i, inputs[s * cols .. s * cols + cols]) for every
+    // sample s < batch, with the same tolerance as gemv.
+    typedef void (*gemm_fn)(const float* weights, size_t stride, size_t rows, size_t cols, const float* inputs, size_t batch, const float* bias, float* outputs);
+
+    // Computes a GEMM_TILE_SAMPLES x GEMM_TILE_ROWS block of gemm output.
+    typedef void (*gemm_tile_fn)(const float* inputs, size_t inputStride, const float* weights, size_t stride, size_t cols, const float* bias, float* outputs, size_t outputStride);
+
+    constexpr size_t GEMM_TILE_SAMPLES = 4;
+    constexpr size_t GEMM_TILE_ROWS = 2;
+
+    // Applies a built-in activation in place; Custom is not accepted.
+    typedef void (*activate_fn)(ActivationKind kind, float* values, size_t size);
+
+    // Writes blocks * 4 Philox4x32-10 outputs, block b using counter {counter[0] + b, counter[1..3]}, in
+    // stream order. Integer-exact, so every level produces identical bits.
+    typedef void (*philox_fn)(const uint32_t* counter, const uint32_t* key, size_t blocks, uint32_t* output);
+
+    // child[i] = bit i of mask ? second[i] : first[i], with bit i stored at mask[i / 32] >> (i % 32).
+    typedef void (*select_fn)(const float* first, const float* second, const uint32_t* mask, size_t size, float* child);
+
+    // child[i] = first[i] + alpha * (second[i] - first[i])
+    typedef void (*blend_fn)(const float* first, const float* second, float alpha, size_t size, float* child);
+
+    // Individuals evaluated side by side by lane_gemv, individual k in lane k of every element.
+    constexpr size_t LANES = 16;
+
+    // outputs[i][k] = bias[i][k] + sum_j weights[i][j][k] * inputs[j][k], each [..][k] element being LANES
+    // consecutive floats (weights[(i * cols + j) * LANES + k]). Every level sums in column order.
+    typedef void (*lane_gemv_fn)(const float* weights, size_t rows, size_t cols, const float* inputs, const float* bias, float* outputs);
+
+    struct KernelTable {
+      SimdLevel level;
+      gemv_fn gemv;
+      gemm_fn gemm;
+      activate_fn activate;
+      activate_fn activateFast;
+      philox_fn philox;
+      select_fn select;
+      blend_fn blend;
+      lane_gemv_fn laneGemv;
+    };
+
+    void gemmBlocked(gemm_tile_fn tile,
+                     gemv_fn gemv,
+                     const float* weights,
+                     size_t stride,
+                     size_t rows,
+                     size_t cols,
+                     const float* inputs,
+                     size_t batch,
+                     const float* bias,
+                     float* outputs);
+
+    void gemvScalar(const float* weights, size_t stride, size_t rows, size_t cols, const float* input, const float* bias, float* output);
+    void gemmScalar(const float* weights, size_t stride, size_t rows, size_t cols, const float* inputs, size_t batch, const float* bias, float* outputs);
+    void activateScalar(ActivationKind kind, float* values, size_t size);
+    void activateFastScalar(ActivationKind kind, float* values, size_t size);
+    void philoxScalar(const uint32_t* counter, const uint32_t* key, size_t blocks, uint32_t* output);
+    void selectScalar(const float* first, const float* second, const uint32_t* mask, size_t size, float* child);
+    void blendScalar(const float* first, const float* second, float alpha, size_t size, float* child);
+    void laneGemvScalar(const float* weights, size_t rows, size_t cols, const float* inputs, const float* bias, float* outputs);
+
+    // Interpolated lookup tables are shared by every level; non-transcendental kinds use the active kernels.
+    void activateTable(ActivationKind kind, float* values, size_t size);
+
+#ifdef NEURO_ARCH_X86
+    void gemvSse2(const float* weights, size_t stride, size_t rows, size_t cols, const float* input, const float* bias, float* output);
+    void gemvAvx2(const float* weights, size_t stride, size_t rows, size_t cols, const float* input, const float* bias, float* output);
+    void gemvAvx512(const float* weights, size_t stride, size_t rows, size_t cols, const float* input, const float* bias, float* output);
+
+    void gemmSse2(const float* weights, size_t stride, size_t rows, size_t cols, const float* inputs, size_t batch, const float* bias, float* outputs);
+    void gemmAvx2(const float* weights, size_t stride, size_t rows, size_t cols, const float* inputs, size_t batch, const float* bias, float* outputs);
+    void gemmAvx512(const float* weights, size_t stride, size_t rows, size_t cols, const float* inputs, size_t batch, const float* bias, float* outputs);
+
+    void activateSse2(ActivationKind kind, float* values, size_t size);
+    void activateAvx2(ActivationKind kind, float* values, size_t size);
+    void activateAvx512(ActivationKind kind, float* values, size_t size);
+
+    void activateFastSse2(ActivationKind kind, float* values, size_t size);
+    void activateFastAvx2(ActivationKind kind, float* values, size_t size);
+    void activateFastAvx512(ActivationKind kind, float* values, size_t size);
+
+    void philoxAvx2(const uint32_t* counter, const uint32_t* key, size_t blocks, uint32_t* output);
+    void philoxAvx512(const uint32_t* counter, const uint32_t* key, size_t blocks, uint32_t* output);
+
+    void selectSse2(const float* first, const float* second, const uint32_t* mask, size_t size, float* child);
+    void selectAvx2(const float* first, const float* second, const uint32_t* mask, size_t size, float* child);
+    void selectAvx512(const float* first, const float* second, const uint32_t* mask, size_t size, float* child);
+
+    void blendSse2(const float* first, const float* second, float alpha, size_t size, float* child);
+    void blendAvx2(const float* first, const float* second, float alpha, size_t size, float* child);
+    void blendAvx512(const float* first, const float* second, float alpha, size_t size, float* child);
+
+    void laneGemvSse2(const float* weights, size_t rows, size_t cols, const float* inputs, const float* bias, float* outputs);
+    void laneGemvAvx2(const float* weights, size_t rows, size_t cols, const float* inputs, const float* bias, float* outputs);
+    void laneGemvAvx512(const float* weights, size_t rows, size_t cols, const float* inputs, const float* bias, float* outputs);
+#endif
+
+    const KernelTable& kernelTable(SimdLevel level);
+
+    const KernelTable& activeKernels();
+
+  } // namespace kernel
+
+} // namespace neuro
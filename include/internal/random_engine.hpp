@@ -1,9 +0,0 @@
-#pragma once
-
-#include <random>
-
-namespace neuro {
-
-  extern std::default_random_engine random_engine;
-
-} // namespace neuro
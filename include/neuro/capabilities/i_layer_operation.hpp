@@ -10,6 +10,10 @@ namespace neuro {
     virtual ~ILayerOperation() = default;
 
     virtual neuro_layer_t feedforward(const neuro_layer_t& inputs) const = 0;
+    virtual void feedforward(const float* inputs, float* outputs) const = 0;
+
+    virtual neuro_layer_t feedforwardBatch(const neuro_layer_t& inputs, size_t batchSize) const = 0;
+    virtual void feedforwardBatch(const float* inputs, size_t batchSize, float* outputs) const = 0;
 
     virtual const ActivationFunction& getActivationFunction() const = 0;
     virtual void setActivationFunction(const ActivationFunction&) = 0;
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 
 #include "neuro/types.hpp"
+#include "neuro/utils/random.hpp"
 
 namespace neuro {
 
@@ -13,9 +15,16 @@ namespace neuro {
     virtual void randomizeWeights(float min, float max) = 0;
     virtual void randomizeBiases(float min, float max) = 0;
 
+    virtual void randomizeWeights(float min, float max, RandomStream& random) = 0;
+    virtual void randomizeBiases(float min, float max, RandomStream& random) = 0;
+
     virtual void mutateWeights(const std::function<float(float)>& mutator) = 0;
     virtual void mutateBiases(const std::function<float(float)>& mutator) = 0;
 
+    // Adds normal(mean, stddev) noise to each parameter with probability rate.
+    virtual void mutateWeights(float rate, float mean, float stddev, RandomStream& random) = 0;
+    virtual void mutateBiases(float rate, float mean, float stddev, RandomStream& random) = 0;
+
     virtual void blendWith(const ILayerWeight& other, float alpha) = 0;
 
     virtual float meanWeight() const = 0;
@@ -41,6 +50,10 @@ namespace neuro {
 
     virtual void setWeights(const layer_weight_t&) = 0;
     virtual void setBiases(const layer_bias_t&) = 0;
+
+    // Changes with every mutating call, non-const reference accessors included, and is kept by copies.
+    // Writes through a reference obtained earlier are not seen, so write through it before evaluating.
+    virtual uint64_t getVersion() const = 0;
   };
 
 } // namespace neuro
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 
+#include "neuro/utils/random.hpp"
+
 namespace neuro {
 
   class INeuralNetworkParameter {
@@ -11,8 +14,15 @@ namespace neuro {
     virtual void randomizeWeights(float min, float max) = 0;
     virtual void randomizeBiases(float min, float max) = 0;
 
+    // Layer l draws from RandomStream(key, l), or RandomStream(key, l | RandomStream::BIAS_STREAM) for biases.
+    virtual void randomizeWeights(float min, float max, const RandomKey& key) = 0;
+    virtual void randomizeBiases(float min, float max, const RandomKey& key) = 0;
+
     virtual void mutateWeights(const std::function<float(float)>& mutator) = 0;
     virtual void mutateBiases(const std::function<float(float)>& mutator) = 0;
+
+    // Combination of the layer versions: equal values mean the same layers with unchanged parameters.
+    virtual uint64_t getVersion() const = 0;
   };
 
 } // namespace neuro
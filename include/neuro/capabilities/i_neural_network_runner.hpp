@@ -2,9 +2,15 @@
 
 #include "neuro/interfaces/i_layer.hpp"
 #include "neuro/types.hpp"
+#include "neuro/utils/inference_workspace.hpp"
 
 namespace neuro {
 
+  struct BatchOptions {
+    // Maximum number of chunks the batch is split into on ThreadPool::global(); 0 uses every pool thread.
+    size_t threads = 1;
+  };
+
   class INeuralNetworkRunner {
    public:
     virtual ~INeuralNetworkRunner() = default;
@@ -12,11 +18,18 @@ namespace neuro {
     virtual neuro_layer_t feedforward(const neuro_layer_t& inputs) const = 0;
     virtual neuro_layer_t operator()(const neuro_layer_t& inputs) const = 0;
 
+    virtual void feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs) const = 0;
+    virtual void feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs, InferenceWorkspace& workspace) const = 0;
+
+    virtual neuro_layer_t feedforwardBatch(const neuro_layer_t& inputs, size_t batchSize) const = 0;
+    virtual neuro_layer_t feedforwardBatch(const neuro_layer_t& inputs, size_t batchSize, const BatchOptions& options) const = 0;
+
     virtual const ILayer& layer(size_t index) const = 0;
     virtual ILayer& layer(size_t index) = 0;
 
     virtual size_t inputSize() const = 0;
     virtual size_t outputSize() const = 0;
+    virtual size_t maxLayerWidth() const = 0;
 
     virtual bool empty() const = 0;
   };
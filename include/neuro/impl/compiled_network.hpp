@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "internal/attribute.hpp"
+#include "neuro/types.hpp"
+#include "neuro/utils/activation.hpp"
+#include "neuro/utils/aligned_allocator.hpp"
+#include "neuro/utils/inference_workspace.hpp"
+#include "neuro/utils/simd.hpp"
+
+namespace neuro {
+
+  class NeuralNetwork;
+
+  namespace kernel {
+    struct KernelTable;
+  } // namespace kernel
+
+  // Frozen inference plan of a NeuralNetwork. Shapes are validated once, weights are copied into one
+  // aligned buffer with rows padded to the vector width of the SIMD level active at compile time, and
+  // each layer is reduced to a kernel call plus a resolved activation. Later changes to the source
+  // network or to setSimdLevel do not affect an existing plan.
+  class CompiledNetwork {
+    struct Step {
+      size_t rows;
+      size_t cols;
+      size_t stride;
+      size_t weightOffset;
+      size_t biasOffset;
+      // kernel::activate_fn, spelled out so the kernel table stays out of the public headers.
+      void (*activate)(ActivationKind kind, float* values, size_t size);
+      ActivationKind kind;
+      ActivationFunction custom;
+    };
+
+    const kernel::KernelTable* kernels;
+    std::vector<Step> steps{};
+    aligned_vector_t<float> parameters{};
+    size_t inputWidth = 0;
+    size_t maxWidth = 0;
+    InferenceWorkspace buffers{};
+
+   public:
+    explicit CompiledNetwork(const NeuralNetwork& network);
+
+    neuro_layer_t feedforward(const neuro_layer_t& inputs);
+
+    // Uses the buffers preallocated by the plan; not safe to call concurrently on one instance.
+    void feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs);
+
+    void feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs, InferenceWorkspace& workspace) const;
+
+    FORCE_INLINE neuro_layer_t operator()(const neuro_layer_t& inputs) {
+      return feedforward(inputs);
+    }
+
+    FORCE_INLINE size_t inputSize() const {
+      return inputWidth;
+    }
+
+    FORCE_INLINE size_t outputSize() const {
+      return steps.back().rows;
+    }
+
+    FORCE_INLINE size_t maxLayerWidth() const {
+      return maxWidth;
+    }
+
+    FORCE_INLINE size_t sizeLayers() const {
+      return steps.size();
+    }
+
+    SimdLevel level() const;
+
+    static size_t packedStride(size_t cols, SimdLevel level);
+
+   private:
+    void run(const float* inputs, float* outputs, InferenceWorkspace& workspace) const;
+  };
+
+} // namespace neuro
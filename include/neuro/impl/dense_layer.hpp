@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -7,6 +8,7 @@
 #include "neuro/makers/activation.hpp"
 #include "neuro/types.hpp"
 #include "neuro/utils/activation.hpp"
+#include "neuro/utils/version.hpp"
 
 namespace neuro {
 
@@ -16,7 +18,15 @@ namespace neuro {
 
     ActivationFunction activation = neuro::maker::activationIdentity();
 
+    size_t parallelThreshold = 0;
+
+    uint64_t version = nextVersion();
+
    public:
+    // Suggested threshold for setParallelThreshold, about where splitting rows across cores outweighs the
+    // cost of waking the pool.
+    static constexpr size_t DEFAULT_PARALLEL_THRESHOLD = size_t(1) << 18;
+
     DenseLayer() = default;
     DenseLayer(const DenseLayer&) = default;
 
@@ -36,6 +46,10 @@ namespace neuro {
     virtual ~DenseLayer() = default;
 
     neuro_layer_t feedforward(const neuro_layer_t& inputs) const override;
+    void feedforward(const float* inputs, float* outputs) const override;
+
+    neuro_layer_t feedforwardBatch(const neuro_layer_t& inputs, size_t batchSize) const override;
+    void feedforwardBatch(const float* inputs, size_t batchSize, float* outputs) const override;
 
     FORCE_INLINE void clear() {
       reshape(inputSize(), outputSize());
@@ -46,9 +60,15 @@ namespace neuro {
     void randomizeWeights(float min, float max) override;
     void randomizeBiases(float min, float max) override;
 
+    void randomizeWeights(float min, float max, RandomStream& random) override;
+    void randomizeBiases(float min, float max, RandomStream& random) override;
+
     void mutateWeights(const std::function<float(float)>& mutator) override;
     void mutateBiases(const std::function<float(float)>& mutator) override;
 
+    void mutateWeights(float rate, float mean, float stddev, RandomStream& random) override;
+    void mutateBiases(float rate, float mean, float stddev, RandomStream& random) override;
+
     void blendWith(const ILayerWeight& other, float alpha) override;
 
     FORCE_INLINE bool validateInternalShape() {
@@ -59,16 +79,11 @@ namespace neuro {
     float meanBias() const override;
 
     FORCE_INLINE size_t inputSize() const {
-      if (weights.empty())
-        UNLIKELY {
-          return 0;
-        }
-
-      return weights[0].size();
+      return weights.cols();
     }
 
     FORCE_INLINE size_t outputSize() const {
-      return weights.size();
+      return weights.rows();
     }
 
     float& weightRef(size_t indexX, size_t indexY) override;
@@ -83,6 +98,22 @@ namespace neuro {
 
     FORCE_INLINE void setActivationFunction(const ActivationFunction& activation) {
       this->activation = activation;
+      touch();
+    }
+
+    FORCE_INLINE void setActivationPrecision(ActivationPrecision precision) {
+      activation.setPrecision(precision);
+      touch();
+    }
+
+    // Single-sample feedforward partitions output rows across ThreadPool::global() once the layer holds
+    // at least this many weights; 0 keeps it single-threaded.
+    FORCE_INLINE void setParallelThreshold(size_t weightCount) {
+      parallelThreshold = weightCount;
+    }
+
+    FORCE_INLINE size_t getParallelThreshold() const {
+      return parallelThreshold;
     }
 
     float getWeight(size_t indexX, size_t indexY) const override;
@@ -92,10 +123,12 @@ namespace neuro {
     void setBias(size_t index, float value) override;
 
     FORCE_INLINE layer_weight_t& getWeights() {
+      touch();
       return weights;
     }
 
     FORCE_INLINE layer_bias_t& getBiases() {
+      touch();
       return biases;
     }
 
@@ -109,10 +142,16 @@ namespace neuro {
 
     FORCE_INLINE void setWeights(const layer_weight_t& weights) {
       this->weights = weights;
+      touch();
     }
 
     FORCE_INLINE void setBiases(const layer_bias_t& biases) {
       this->biases = biases;
+      touch();
+    }
+
+    FORCE_INLINE uint64_t getVersion() const {
+      return version;
     }
 
     FORCE_INLINE std::unique_ptr<ILayer> clone() const {
@@ -122,6 +161,12 @@ namespace neuro {
     ILayer& operator=(const ILayer&);
 
    private:
+    FORCE_INLINE void touch() {
+      version = nextVersion();
+    }
+
+    void computeRows(const float* inputs, size_t cols, float* outputs) const;
+
     virtual bool validateInternalShape(const layer_weight_t& weights, const layer_bias_t& biases);
 
     virtual void checkWeightIndex(size_t indexX, size_t indexY) const;
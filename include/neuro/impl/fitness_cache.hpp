@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+#include "internal/attribute.hpp"
+#include "neuro/interfaces/i_neural_network.hpp"
+
+namespace neuro {
+
+  // Fitness of previously evaluated genomes, keyed by a 64-bit hash of shapes, activation kinds and
+  // parameter bits. Pass it through EvaluationOptions::cache to skip genomes already scored, including
+  // identical offspring within one generation. Only valid for deterministic fitness functions; custom
+  // activations are told apart by kind alone. Cleared whenever it would exceed its capacity.
+  class FitnessCache {
+    std::unordered_map<uint64_t, float> entries{};
+    size_t capacity;
+
+    size_t hitCount = 0;
+    size_t missCount = 0;
+
+   public:
+    explicit FitnessCache(size_t capacity = size_t(1) << 20)
+      : capacity(capacity) {}
+
+    static uint64_t hash(const INeuralNetwork& network);
+
+    bool find(uint64_t hash, float& fitness);
+    void insert(uint64_t hash, float fitness);
+
+    FORCE_INLINE void clear() {
+      entries.clear();
+    }
+
+    FORCE_INLINE size_t size() const {
+      return entries.size();
+    }
+
+    FORCE_INLINE size_t hits() const {
+      return hitCount;
+    }
+
+    FORCE_INLINE size_t misses() const {
+      return missCount;
+    }
+  };
+
+} // namespace neuro
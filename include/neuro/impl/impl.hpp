@@ -1,6 +1,10 @@
 #pragma once
 
+#include "neuro/impl/compiled_network.hpp"
 #include "neuro/impl/dense_layer.hpp"
+#include "neuro/impl/fitness_cache.hpp"
 #include "neuro/impl/individual.hpp"
 #include "neuro/impl/neural_network.hpp"
 #include "neuro/impl/population.hpp"
+#include "neuro/impl/population_arena.hpp"
+#include "neuro/impl/static_network.hpp"
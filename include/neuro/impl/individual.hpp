@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -17,6 +18,9 @@ namespace neuro {
     std::unique_ptr<INeuralNetwork> neuralNetwork;
     float fitness{};
 
+    bool evaluated = false;
+    uint64_t evaluatedVersion = 0;
+
    public:
     Individual();
     Individual(const Individual&);
@@ -34,7 +38,7 @@ namespace neuro {
     virtual ~Individual() = default;
 
     FORCE_INLINE void evaluateFitness(const std::function<float(const INeuralNetwork&)>& evaluateFunction) {
-      fitness = evaluateFunction(*neuralNetwork);
+      markEvaluated(evaluateFunction(*neuralNetwork));
     }
 
     FORCE_INLINE const INeuralNetwork& getNeuralNetwork() const {
@@ -59,6 +63,17 @@ namespace neuro {
 
     FORCE_INLINE void setFitness(float fitness) {
       this->fitness = fitness;
+      evaluated = false;
+    }
+
+    FORCE_INLINE bool isFitnessCurrent() const {
+      return evaluated && evaluatedVersion == neuralNetwork->getVersion();
+    }
+
+    FORCE_INLINE void markEvaluated(float fitness) {
+      this->fitness = fitness;
+      evaluated = true;
+      evaluatedVersion = neuralNetwork->getVersion();
     }
 
     FORCE_INLINE std::unique_ptr<IIndividual> clone() const {
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
 
 #include "internal/attribute.hpp"
+#include "neuro/impl/compiled_network.hpp"
 #include "neuro/interfaces/i_layer.hpp"
 #include "neuro/interfaces/i_neural_network.hpp"
 #include "neuro/types.hpp"
@@ -39,9 +41,24 @@ namespace neuro {
 
     neuro_layer_t feedforward(const neuro_layer_t& inputs) const override;
 
+    FORCE_INLINE void feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs) const {
+      feedforward(inputs, outputs, InferenceWorkspace::local());
+    }
+
+    void feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs, InferenceWorkspace& workspace) const override;
+
+    FORCE_INLINE neuro_layer_t feedforwardBatch(const neuro_layer_t& inputs, size_t batchSize) const {
+      return feedforwardBatch(inputs, batchSize, BatchOptions{});
+    }
+
+    neuro_layer_t feedforwardBatch(const neuro_layer_t& inputs, size_t batchSize, const BatchOptions& options) const override;
+
     void randomizeWeights(float min, float max) override;
     void randomizeBiases(float min, float max) override;
 
+    void randomizeWeights(float min, float max, const RandomKey& key) override;
+    void randomizeBiases(float min, float max, const RandomKey& key) override;
+
     void mutateWeights(const std::function<float(float)>& mutator) override;
     void mutateBiases(const std::function<float(float)>& mutator) override;
 
@@ -90,6 +107,10 @@ namespace neuro {
       return layers.empty() ? 0 : layers[layers.size() - 1]->outputSize();
     }
 
+    size_t maxLayerWidth() const override;
+
+    uint64_t getVersion() const override;
+
     FORCE_INLINE void setLayers(std::vector<std::unique_ptr<ILayer>> layers) {
       this->layers = std::move(layers);
     }
@@ -141,9 +162,16 @@ namespace neuro {
     const ILayer& operator[](size_t index) const override;
     ILayer& operator[](size_t index) override;
 
+    FORCE_INLINE CompiledNetwork compile() const {
+      return CompiledNetwork(*this);
+    }
+
     FORCE_INLINE std::unique_ptr<INeuralNetwork> clone() const {
       return std::make_unique<NeuralNetwork>(*this);
     }
+
+   private:
+    void feedforwardBatchRange(const float* inputs, size_t batchSize, float* outputs) const;
   };
 
 } // namespace neuro
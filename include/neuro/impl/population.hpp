@@ -1,15 +1,51 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "internal/attribute.hpp"
 #include "neuro/interfaces/i_individual.hpp"
 #include "neuro/interfaces/i_population.hpp"
 #include "neuro/utils/activation.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
 
 namespace neuro {
 
+  // Successive-halving evaluation on a dataset. Every individual is scored on the first rungs[0] samples,
+  // then only the best keepFraction of them go on to rungs[1] samples, and so on; each rung only scores the
+  // samples the previous one did not. Fitness is the mean score over the samples an individual saw. Those
+  // eliminated keep that partial fitness, capped strictly below everyone who went further so the race
+  // order survives, and set with setFitness so it never counts as current.
+  struct RacingOptions {
+    // Strictly increasing sample counts; the last one is usually the dataset size. Empty scores everything.
+    std::vector<size_t> rungs{};
+
+    // Share of the contestants of a rung that advance to the next, at least one of them.
+    float keepFraction = 0.5f;
+
+    // Samples are visited in an order shuffled from seed, so every rung is a random subsample.
+    bool shuffle = true;
+    uint64_t seed = 0;
+
+    // Threads, chunking and budgets of each rung. skipEvaluated and cache do not apply.
+    EvaluationOptions evaluation{};
+
+    // Rungs of minSamples, minSamples * eta, ... up to datasetSize, keeping 1 / eta of each rung.
+    static RacingOptions halving(size_t minSamples, size_t datasetSize, size_t eta = 2);
+
+    bool operator!=(const RacingOptions& other) const {
+      return !(*this == other);
+    }
+
+    bool operator==(const RacingOptions& other) const {
+      return rungs == other.rungs && keepFraction == other.keepFraction && shuffle == other.shuffle && seed == other.seed &&
+             evaluation == other.evaluation;
+    }
+  };
+
   class Population : public IPopulation {
     std::vector<std::shared_ptr<IIndividual>> individuals{};
 
@@ -28,6 +64,9 @@ namespace neuro {
     void randomizeWeights(float min, float max) override;
     void randomizeBiases(float min, float max) override;
 
+    void randomizeWeights(float min, float max, uint64_t seed) override;
+    void randomizeBiases(float min, float max, uint64_t seed) override;
+
     void addIndividuals(const std::vector<IIndividual>&) override;
 
     FORCE_INLINE void addIndividual(const IIndividual& individual) {
@@ -54,8 +93,55 @@ namespace neuro {
       individuals.reserve(size);
     }
 
+    FORCE_INLINE void evaluateFitness(const std::function<float(const INeuralNetwork&)>& evaluateFunction) {
+      evaluateFitness(evaluateFunction, EvaluationOptions{});
+    }
+
+    void evaluateFitness(const std::function<float(const INeuralNetwork&)>& evaluateFunction, const EvaluationOptions& options) override;
+
+    void evaluateFitness(const std::function<float(const INeuralNetwork&, EvaluationToken&)>& evaluateFunction, const EvaluationOptions& options) override;
+
+    // Each evaluator calls makeScratch() once and passes the result to every evaluate(network, scratch)
+    // it runs, so simulator state or buffers are reused without being shared between threads.
+    template <typename MakeScratch, typename Evaluate>
+    void evaluateFitness(const MakeScratch& makeScratch, const Evaluate& evaluate, const EvaluationOptions& options) {
+      using scratch_t = std::decay_t<decltype(makeScratch())>;
+
+      evaluateFitnessWith(
+        [&]() -> evaluator_t {
+          return [&evaluate, scratch = std::make_shared<scratch_t>(makeScratch())](const INeuralNetwork& network, EvaluationToken&) {
+            return evaluate(network, *scratch);
+          };
+        },
+        options);
+    }
+
+    // Races the population over a dataset of datasetSize samples; see RacingOptions. score returns the sum
+    // of the per-sample scores of network over samples[0..count), higher being better. Returns the number
+    // of samples scored over all individuals.
+    size_t evaluateFitnessRacing(size_t datasetSize,
+                                 const std::function<float(const INeuralNetwork&, const size_t* samples, size_t count)>& score,
+                                 const RacingOptions& options);
+
+    std::vector<neuro_layer_t> feedforwardBatch(const neuro_layer_t& inputs, size_t samples) const override;
+
+    FORCE_INLINE void evaluateFitnessBatch(const neuro_layer_t& inputs, size_t samples, const std::function<float(neuro_layer_const_span_t outputs)>& score) {
+      evaluateFitnessBatch(inputs, samples, score, EvaluationOptions{});
+    }
+
+    void evaluateFitnessBatch(const neuro_layer_t& inputs,
+                              size_t samples,
+                              const std::function<float(neuro_layer_const_span_t outputs)>& score,
+                              const EvaluationOptions& options) override;
+
     const IIndividual& getBestIndividual() const override;
 
+    // Indices of the k fittest individuals, fittest first, from one pass over the fitness getters.
+    std::vector<size_t> topK(size_t k) const;
+
+    // Fitness of every individual in index order.
+    std::vector<float> getFitnesses() const;
+
     FORCE_INLINE const std::vector<std::shared_ptr<IIndividual>>& getIndividuals() const {
       return individuals;
     }
@@ -97,6 +183,17 @@ namespace neuro {
     FORCE_INLINE std::unique_ptr<IPopulation> clone() const {
       return std::make_unique<Population>(*this);
     }
+
+   private:
+    using evaluator_t = std::function<float(const INeuralNetwork&, EvaluationToken&)>;
+
+    void evaluateFitnessWith(const std::function<evaluator_t()>& makeEvaluator, const EvaluationOptions& options);
+
+    // Evaluates individuals order[0..count), or the first count when order is null.
+    void evaluateIndividuals(const std::function<evaluator_t()>& makeEvaluator,
+                             const EvaluationOptions& options,
+                             const size_t* order,
+                             size_t count);
   };
 
 } // namespace neuro
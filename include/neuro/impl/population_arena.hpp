@@ -0,0 +1,227 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "internal/attribute.hpp"
+#include "neuro/impl/neural_network.hpp"
+#include "neuro/interfaces/i_neural_network.hpp"
+#include "neuro/interfaces/i_population.hpp"
+#include "neuro/types.hpp"
+#include "neuro/utils/activation.hpp"
+#include "neuro/utils/aligned_allocator.hpp"
+#include "neuro/utils/crossover.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
+#include "neuro/utils/inference_workspace.hpp"
+#include "neuro/utils/random.hpp"
+
+namespace neuro {
+
+  class PopulationArena;
+
+  // Read-only handle on one arena individual; cheap to copy and only valid while the arena keeps its size.
+  class IndividualView {
+    const PopulationArena* arena;
+    size_t index;
+
+   public:
+    IndividualView(const PopulationArena& arena, size_t index)
+      : arena(&arena),
+        index(index) {}
+
+    const float* parameters() const;
+
+    layer_weight_const_view_t weights(size_t layer) const;
+    neuro_layer_const_span_t biases(size_t layer) const;
+
+    float getFitness() const;
+
+    neuro_layer_t feedforward(const neuro_layer_t& inputs) const;
+    void feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs) const;
+    void feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs, InferenceWorkspace& workspace) const;
+
+    // inputs is samples x inputSize and outputs samples x outputSize, both row-major.
+    void feedforwardBatch(const float* inputs, size_t samples, float* outputs, InferenceWorkspace& workspace) const;
+
+    FORCE_INLINE size_t getIndex() const {
+      return index;
+    }
+  };
+
+  // Population of dense networks sharing one topology. Every genome lives in a single aligned block,
+  // individual-major, each layer stored as its row-major weights followed by its biases, and fitness is a
+  // parallel array. Genomes start on a cache line but carry no per-row padding, so an individual costs its
+  // parameters plus at most one cache line. Randomization and mutation consume the same keyed streams as a
+  // Population of NeuralNetworks with the same topology, so both produce identical parameters.
+  class PopulationArena {
+    friend class IndividualView;
+
+    struct Layer {
+      size_t rows;
+      size_t cols;
+      size_t weightOffset;
+      size_t biasOffset;
+      ActivationFunction activation;
+    };
+
+    std::vector<Layer> layers{};
+    size_t parameterSize = 0;
+    size_t genomeStride = 0;
+    size_t maxWidth = 0;
+
+    aligned_vector_t<float> genomes{};
+    std::vector<float> fitness{};
+
+   public:
+    // Individuals evaluated together by feedforwardLanes, and the widest layer it is preferred for.
+    static constexpr size_t LANE_COUNT = 16;
+    static constexpr size_t LANE_MAX_WIDTH = 32;
+
+    PopulationArena() = default;
+
+    PopulationArena(size_t size, const std::vector<int>& structure);
+    PopulationArena(size_t size, const std::vector<int>& structure, const ActivationFunction& activation);
+    PopulationArena(size_t size, const std::vector<int>& structure, const std::vector<ActivationFunction>& activations);
+
+    // Copies the parameters and fitness of every individual; all of them must share the first one's topology.
+    explicit PopulationArena(const IPopulation& population);
+
+    void resize(size_t size);
+
+    void randomizeWeights(float min, float max);
+    void randomizeBiases(float min, float max);
+
+    // Individual i is randomized with RandomKey{seed, 0, i}, like Population::randomizeWeights(min, max, seed).
+    void randomizeWeights(float min, float max, uint64_t seed);
+    void randomizeBiases(float min, float max, uint64_t seed);
+
+    // Mutates individual index with the layer streams of key, like GeneticTrainer::mutate.
+    void mutate(size_t index, float rate, float mean, float stddev, const RandomKey& key);
+
+    // Mutates individuals [begin, size()) in parallel, individual i keyed by {seed, generation, i}.
+    void mutate(float rate, float mean, float stddev, uint64_t seed, uint32_t generation, size_t begin = 0);
+
+    // Recombines two genomes of this arena (or of one with the same topology) into child in one pass.
+    void crossover(const float* first, const float* second, size_t child, const CrossoverOptions& options, RandomStream& random);
+
+    void copy(size_t from, size_t to);
+    void copy(const PopulationArena& source, size_t from, size_t to);
+
+    void evaluateFitness(const std::function<float(const IndividualView&)>& evaluateFunction, const EvaluationOptions& options = {});
+
+    // Honours the budget fields of options like Population::evaluateFitness.
+    void evaluateFitness(const std::function<float(const IndividualView&, EvaluationToken&)>& evaluateFunction, const EvaluationOptions& options = {});
+
+    // Runs every individual on one shared batch; individual i writes samples x outputSize values at
+    // outputs + i * samples * outputSize(). Micro topologies go through feedforwardLanes.
+    void feedforwardBatch(const float* inputs, size_t samples, float* outputs) const;
+    neuro_layer_t feedforwardBatch(const neuro_layer_t& inputs, size_t samples) const;
+
+    // Same contract as feedforwardBatch, but LANE_COUNT individuals at a time: their genomes are
+    // interleaved so individual k sits in SIMD lane k and every vector multiply-add advances all of them.
+    void feedforwardLanes(const float* inputs, size_t samples, float* outputs) const;
+
+    // Sets each fitness to score(outputs) on the shared batch. Every evaluator reuses one output buffer.
+    // Cancellation and the time limit apply to each lane group (or individual) as a whole, so a group that
+    // overruns is penalized entirely; score never sees a token, so stepLimit does not apply.
+    void evaluateFitnessBatch(const neuro_layer_t& inputs,
+                              size_t samples,
+                              const std::function<float(neuro_layer_const_span_t outputs)>& score,
+                              const EvaluationOptions& options = {});
+
+    size_t bestIndex() const;
+
+    // Indices of the k fittest individuals, fittest first; see selectTop.
+    std::vector<size_t> topK(size_t k) const;
+
+    NeuralNetwork toNeuralNetwork(size_t index) const;
+    void assign(size_t index, const INeuralNetwork& network);
+
+    FORCE_INLINE void swap(PopulationArena& other) {
+      layers.swap(other.layers);
+      std::swap(parameterSize, other.parameterSize);
+      std::swap(genomeStride, other.genomeStride);
+      std::swap(maxWidth, other.maxWidth);
+      genomes.swap(other.genomes);
+      fitness.swap(other.fitness);
+    }
+
+    FORCE_INLINE IndividualView operator[](size_t index) const {
+      return IndividualView(*this, index);
+    }
+
+    FORCE_INLINE float* parameters(size_t index) {
+      return genomes.data() + index * genomeStride;
+    }
+
+    FORCE_INLINE const float* parameters(size_t index) const {
+      return genomes.data() + index * genomeStride;
+    }
+
+    FORCE_INLINE float getFitness(size_t index) const {
+      return fitness[index];
+    }
+
+    FORCE_INLINE void setFitness(size_t index, float value) {
+      fitness[index] = value;
+    }
+
+    FORCE_INLINE const std::vector<float>& getFitnesses() const {
+      return fitness;
+    }
+
+    FORCE_INLINE size_t size() const {
+      return fitness.size();
+    }
+
+    FORCE_INLINE bool empty() const {
+      return fitness.empty();
+    }
+
+    FORCE_INLINE size_t sizeLayers() const {
+      return layers.size();
+    }
+
+    // Parameters per individual, and the distance in floats between two consecutive genomes.
+    FORCE_INLINE size_t parameterCount() const {
+      return parameterSize;
+    }
+
+    FORCE_INLINE size_t stride() const {
+      return genomeStride;
+    }
+
+    FORCE_INLINE size_t inputSize() const {
+      return layers.empty() ? 0 : layers.front().cols;
+    }
+
+    FORCE_INLINE size_t outputSize() const {
+      return layers.empty() ? 0 : layers.back().rows;
+    }
+
+    FORCE_INLINE size_t maxLayerWidth() const {
+      return maxWidth;
+    }
+
+    FORCE_INLINE bool prefersLanes() const {
+      return maxWidth <= LANE_MAX_WIDTH && size() >= LANE_COUNT;
+    }
+
+    // Same topology and activation kinds, so genomes can be copied or recombined between the two arenas.
+    bool compatible(const PopulationArena& other) const;
+
+   private:
+    void initialize(const std::vector<int>& structure, const std::vector<ActivationFunction>& activations);
+
+    void run(const float* genome, const float* inputs, float* outputs, InferenceWorkspace& workspace) const;
+    void runBatch(const float* genome, const float* inputs, size_t samples, float* outputs, InferenceWorkspace& workspace) const;
+
+    aligned_vector_t<float> broadcastInputs(const float* inputs, size_t samples) const;
+    void packLanes(size_t first, float* packed) const;
+    void runLanes(const float* packed, const float* broadcast, size_t samples, size_t count, float* outputs, InferenceWorkspace& workspace) const;
+  };
+
+} // namespace neuro
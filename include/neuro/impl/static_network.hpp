@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "internal/attribute.hpp"
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+#include "neuro/impl/dense_layer.hpp"
+#include "neuro/impl/neural_network.hpp"
+#include "neuro/makers/activation.hpp"
+#include "neuro/types.hpp"
+#include "neuro/utils/activation.hpp"
+
+namespace neuro {
+
+  // Dense network whose topology and activation are compile-time constants. Parameters live in a single
+  // std::array laid out layer by layer (row-major weights followed by biases) and every loop is unrolled,
+  // so there is no allocation or virtual dispatch on the inference path. Intended for small controllers;
+  // train through NeuralNetwork and convert back and forth.
+  template <ActivationKind Activation, size_t... Sizes>
+  class StaticNetwork {
+    static_assert(sizeof...(Sizes) >= 2, "A static network needs at least an input and an output size");
+    static_assert(((Sizes > 0) && ...), "Static network layer sizes must be positive");
+    static_assert(Activation != ActivationKind::Custom, "Static networks require a built-in activation");
+
+   public:
+    static constexpr size_t LAYER_COUNT = sizeof...(Sizes) - 1;
+    static constexpr std::array<size_t, sizeof...(Sizes)> STRUCTURE{Sizes...};
+    static constexpr size_t INPUT_SIZE = STRUCTURE[0];
+    static constexpr size_t OUTPUT_SIZE = STRUCTURE[LAYER_COUNT];
+    static constexpr size_t MAX_WIDTH = std::max({Sizes...});
+
+    using input_t = std::array<float, INPUT_SIZE>;
+    using output_t = std::array<float, OUTPUT_SIZE>;
+
+   private:
+    static constexpr std::array<size_t, LAYER_COUNT + 1> OFFSETS = [] {
+      std::array<size_t, LAYER_COUNT + 1> offsets{};
+
+      for (size_t i = 0; i < LAYER_COUNT; i++) {
+        offsets[i + 1] = offsets[i] + STRUCTURE[i + 1] * (STRUCTURE[i] + 1);
+      }
+
+      return offsets;
+    }();
+
+   public:
+    static constexpr size_t PARAMETER_COUNT = OFFSETS[LAYER_COUNT];
+
+   private:
+    std::array<float, PARAMETER_COUNT> parameters{};
+
+   public:
+    StaticNetwork() = default;
+
+    explicit StaticNetwork(const NeuralNetwork& network) {
+      if (network.sizeLayers() != LAYER_COUNT) {
+        throw exception::InvalidNetworkArchitectureException("Static network expects " + std::to_string(LAYER_COUNT) + " layers, got " +
+                                                             std::to_string(network.sizeLayers()));
+      }
+
+      for (size_t l = 0; l < LAYER_COUNT; l++) {
+        const ILayer& layer = network[l];
+
+        if (layer.inputSize() != STRUCTURE[l] || layer.outputSize() != STRUCTURE[l + 1]) {
+          throw exception::InvalidNetworkArchitectureException("Static network layer " + std::to_string(l) + " shape mismatch");
+        }
+
+        const auto* dense = dynamic_cast<const DenseLayer*>(&layer);
+
+        if (dense == nullptr || dense->getActivationFunction().getKind() != Activation) {
+          throw exception::InvalidNetworkArchitectureException("Static network layer " + std::to_string(l) + " must be a dense " +
+                                                               activationName(Activation) + " layer");
+        }
+
+        const auto& weights = layer.getWeights();
+        const auto& biases = layer.getBiases();
+
+        for (size_t row = 0; row < STRUCTURE[l + 1]; row++) {
+          std::copy(weights.row(row).begin(), weights.row(row).end(), layerWeights(l) + row * STRUCTURE[l]);
+        }
+
+        std::copy(biases.begin(), biases.end(), layerBiases(l));
+      }
+    }
+
+    NeuralNetwork toNeuralNetwork() const {
+      std::vector<std::unique_ptr<ILayer>> layers;
+
+      for (size_t l = 0; l < LAYER_COUNT; l++) {
+        layer_weight_t weights(STRUCTURE[l + 1], STRUCTURE[l]);
+
+        for (size_t row = 0; row < STRUCTURE[l + 1]; row++) {
+          std::copy_n(layerWeights(l) + row * STRUCTURE[l], STRUCTURE[l], weights.row(row).begin());
+        }
+
+        layer_bias_t biases(layerBiases(l), layerBiases(l) + STRUCTURE[l + 1]);
+
+        layers.push_back(std::make_unique<DenseLayer>(weights, biases, maker::activation(Activation)));
+      }
+
+      return NeuralNetwork(std::move(layers));
+    }
+
+    FORCE_INLINE output_t feedforward(const input_t& inputs) const {
+      output_t outputs;
+      feedforward(inputs.data(), outputs.data());
+
+      return outputs;
+    }
+
+    FORCE_INLINE void feedforward(const float* inputs, float* outputs) const {
+      run(std::make_index_sequence<LAYER_COUNT>{}, inputs, outputs);
+    }
+
+    FORCE_INLINE output_t operator()(const input_t& inputs) const {
+      return feedforward(inputs);
+    }
+
+    FORCE_INLINE float& weight(size_t layer, size_t row, size_t col) {
+      return layerWeights(layer)[row * STRUCTURE[layer] + col];
+    }
+
+    FORCE_INLINE float weight(size_t layer, size_t row, size_t col) const {
+      return layerWeights(layer)[row * STRUCTURE[layer] + col];
+    }
+
+    FORCE_INLINE float& bias(size_t layer, size_t row) {
+      return layerBiases(layer)[row];
+    }
+
+    FORCE_INLINE float bias(size_t layer, size_t row) const {
+      return layerBiases(layer)[row];
+    }
+
+    FORCE_INLINE std::array<float, PARAMETER_COUNT>& getParameters() {
+      return parameters;
+    }
+
+    FORCE_INLINE const std::array<float, PARAMETER_COUNT>& getParameters() const {
+      return parameters;
+    }
+
+   private:
+    FORCE_INLINE float* layerWeights(size_t layer) {
+      return parameters.data() + OFFSETS[layer];
+    }
+
+    FORCE_INLINE const float* layerWeights(size_t layer) const {
+      return parameters.data() + OFFSETS[layer];
+    }
+
+    FORCE_INLINE float* layerBiases(size_t layer) {
+      return layerWeights(layer) + STRUCTURE[layer + 1] * STRUCTURE[layer];
+    }
+
+    FORCE_INLINE const float* layerBiases(size_t layer) const {
+      return layerWeights(layer) + STRUCTURE[layer + 1] * STRUCTURE[layer];
+    }
+
+    template <typename Function, size_t... Indices>
+    static FORCE_INLINE void unroll(Function&& function, std::index_sequence<Indices...>) {
+      (function(std::integral_constant<size_t, Indices>{}), ...);
+    }
+
+    static FORCE_INLINE float activate(float x) {
+      if constexpr (Activation == ActivationKind::Sigmoid) {
+        return 1.0f / (1.0f + std::exp(-x));
+      } else if constexpr (Activation == ActivationKind::Relu) {
+        return x > 0 ? x : 0.0f;
+      } else if constexpr (Activation == ActivationKind::Tanh) {
+        return std::tanh(x);
+      } else if constexpr (Activation == ActivationKind::LeakyRelu) {
+        return x > 0 ? x : 0.01f * x;
+      } else if constexpr (Activation == ActivationKind::Elu) {
+        return x >= 0 ? x : std::exp(x) - 1.0f;
+      } else if constexpr (Activation == ActivationKind::Swish) {
+        return x / (1.0f + std::exp(-x));
+      } else if constexpr (Activation == ActivationKind::Softplus) {
+        return std::log1p(std::exp(x));
+      } else if constexpr (Activation == ActivationKind::HardSigmoid) {
+        return std::max(0.0f, std::min(1.0f, 0.2f * x + 0.5f));
+      } else {
+        return x;
+      }
+    }
+
+    template <size_t Layer>
+    FORCE_INLINE void layerFeedforward(const float* inputs, float* outputs) const {
+      constexpr size_t cols = STRUCTURE[Layer];
+      constexpr size_t rows = STRUCTURE[Layer + 1];
+
+      const float* weights = parameters.data() + OFFSETS[Layer];
+      const float* biases = weights + rows * cols;
+
+      unroll(
+        [&](auto row) {
+          float total = biases[row];
+
+          unroll([&](auto col) { total += weights[row * cols + col] * inputs[col]; }, std::make_index_sequence<cols>{});
+
+          outputs[row] = activate(total);
+        },
+        std::make_index_sequence<rows>{});
+    }
+
+    template <size_t... Layers>
+    FORCE_INLINE void run(std::index_sequence<Layers...>, const float* inputs, float* outputs) const {
+      std::array<float, MAX_WIDTH> buffers[2];
+      const float* current = inputs;
+
+      ((layerFeedforward<Layers>(current, Layers + 1 == LAYER_COUNT ? outputs : buffers[Layers % 2].data()), current = buffers[Layers % 2].data()), ...);
+    }
+  };
+
+} // namespace neuro
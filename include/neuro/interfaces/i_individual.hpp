@@ -23,8 +23,15 @@ namespace neuro {
 
     virtual float getFitness() const = 0;
 
+    // Hand-set fitness is not tied to the network, so isFitnessCurrent() turns false.
     virtual void setFitness(float) = 0;
 
+    // True while the fitness comes from evaluateFitness or markEvaluated and the network is unchanged since.
+    virtual bool isFitnessCurrent() const = 0;
+
+    // Records fitness as the evaluation of the network as it is now.
+    virtual void markEvaluated(float fitness) = 0;
+
     virtual std::unique_ptr<IIndividual> clone() const = 0;
   };
 
@@ -1,12 +1,62 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <vector>
 
 #include "neuro/interfaces/i_individual.hpp"
+#include "neuro/interfaces/i_neural_network.hpp"
+#include "neuro/types.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
 
 namespace neuro {
 
+  class FitnessCache;
+
+  struct EvaluationOptions {
+    // Concurrent evaluators on ThreadPool::global(); 0 uses every pool thread and 1 evaluates serially.
+    size_t threads = 0;
+
+    // Individuals an evaluator claims at a time. Small chunks balance heavy-tailed fitness functions,
+    // larger ones reduce contention on the shared cursor for cheap ones.
+    size_t chunkSize = 1;
+
+    // Skips individuals whose fitness is current (IIndividual::isFitnessCurrent), such as unchanged elites.
+    // Only sound for deterministic fitness functions.
+    bool skipEvaluated = false;
+
+    // Reuses the fitness of genomes seen before and evaluates identical genomes once. Not owned.
+    FitnessCache* cache = nullptr;
+
+    // Budget of each evaluation; zero means unlimited. The step limit is only enforced through
+    // EvaluationToken::step, the time limit also on functions that ignore their token.
+    std::chrono::nanoseconds timeLimit{0};
+    size_t stepLimit = 0;
+
+    // Fitness given to evaluations that ran out of budget or were cancelled. It is set with setFitness, so
+    // those individuals are not current and never cached; the finite default keeps Roulette selection sound.
+    float timeoutFitness = TIMEOUT_FITNESS;
+
+    // Once cancelled, running evaluations are told to stop and pending ones get timeoutFitness. Not owned.
+    const CancellationSource* cancellation = nullptr;
+
+    // Tallies the outcome of every evaluation, counting those skipped after cancellation as cancelled. Not owned.
+    EvaluationCounters* counters = nullptr;
+
+    bool operator!=(const EvaluationOptions& other) const {
+      return !(*this == other);
+    }
+
+    bool operator==(const EvaluationOptions& other) const {
+      return threads == other.threads && chunkSize == other.chunkSize && skipEvaluated == other.skipEvaluated && cache == other.cache &&
+             timeLimit == other.timeLimit && stepLimit == other.stepLimit && timeoutFitness == other.timeoutFitness &&
+             cancellation == other.cancellation && counters == other.counters;
+    }
+  };
+
   class IPopulation {
    public:
     IPopulation() = default;
@@ -15,6 +65,10 @@ namespace neuro {
     virtual void randomizeWeights(float min, float max) = 0;
     virtual void randomizeBiases(float min, float max) = 0;
 
+    // Individual i is randomized with RandomKey{seed, 0, i}, so the result does not depend on thread count.
+    virtual void randomizeWeights(float min, float max, uint64_t seed) = 0;
+    virtual void randomizeBiases(float min, float max, uint64_t seed) = 0;
+
     virtual void addIndividuals(const std::vector<IIndividual>&) = 0;
     virtual void addIndividual(const IIndividual&) = 0;
     virtual void addIndividuals(std::vector<std::shared_ptr<IIndividual>>&) = 0;
@@ -26,6 +80,23 @@ namespace neuro {
 
     virtual void reserve(size_t size) = 0;
 
+    virtual void evaluateFitness(const std::function<float(const INeuralNetwork&)>& evaluateFunction, const EvaluationOptions& options) = 0;
+
+    // Cooperative variant: the function receives the budget of its evaluation and should return early
+    // once EvaluationToken::step or shouldStop reports that it must stop.
+    virtual void evaluateFitness(const std::function<float(const INeuralNetwork&, EvaluationToken&)>& evaluateFunction,
+                                 const EvaluationOptions& options) = 0;
+
+    // Runs every individual on one shared batch (samples x inputSize, row-major). result[i] holds the
+    // outputs of individual i, samples x its outputSize; topologies may differ between individuals.
+    virtual std::vector<neuro_layer_t> feedforwardBatch(const neuro_layer_t& inputs, size_t samples) const = 0;
+
+    // Sets each fitness to score(outputs), outputs being the individual's answers to the shared batch.
+    virtual void evaluateFitnessBatch(const neuro_layer_t& inputs,
+                                      size_t samples,
+                                      const std::function<float(neuro_layer_const_span_t outputs)>& score,
+                                      const EvaluationOptions& options) = 0;
+
     virtual const IIndividual& getBestIndividual() const = 0;
 
     virtual const std::vector<std::shared_ptr<IIndividual>>& getIndividuals() const = 0;
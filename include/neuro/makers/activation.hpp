@@ -4,6 +4,7 @@
 #include <functional>
 
 #include "internal/attribute.hpp"
+#include "neuro/exceptions/exception.hpp"
 #include "neuro/utils/activation.hpp"
 
 namespace neuro {
@@ -11,40 +12,64 @@ namespace neuro {
   namespace maker {
 
     FORCE_INLINE ActivationFunction activationSigmoid() {
-      return {[](float x) { return 1.0f / (1.0f + std::exp(-x)); }, [](float y) { return y * (1.0f - y); }};
+      return {[](float x) { return 1.0f / (1.0f + std::exp(-x)); }, [](float y) { return y * (1.0f - y); }, ActivationKind::Sigmoid};
     }
 
     FORCE_INLINE ActivationFunction activationRelu() {
-      return {[](float x) { return x > 0 ? x : 0.0f; }, [](float y) { return y > 0 ? 1.0f : 0.0f; }};
+      return {[](float x) { return x > 0 ? x : 0.0f; }, [](float y) { return y > 0 ? 1.0f : 0.0f; }, ActivationKind::Relu};
     }
 
     FORCE_INLINE ActivationFunction activationTanh_fn() {
-      return {[](float x) { return std::tanh(x); }, [](float y) { return 1.0f - y * y; }};
+      return {[](float x) { return std::tanh(x); }, [](float y) { return 1.0f - y * y; }, ActivationKind::Tanh};
     }
 
     FORCE_INLINE ActivationFunction activationLeaky_relu() {
-      return {[](float x) { return x > 0 ? x : 0.01f * x; }, [](float y) { return y > 0 ? 1.0f : 0.01f; }};
+      return {[](float x) { return x > 0 ? x : 0.01f * x; }, [](float y) { return y > 0 ? 1.0f : 0.01f; }, ActivationKind::LeakyRelu};
     }
 
     FORCE_INLINE ActivationFunction activationElu() {
-      return {[](float x) { return x >= 0 ? x : std::exp(x) - 1.0f; }, [](float y) { return y >= 0 ? 1.0f : y + 1.0f; }};
+      return {[](float x) { return x >= 0 ? x : std::exp(x) - 1.0f; }, [](float y) { return y >= 0 ? 1.0f : y + 1.0f; }, ActivationKind::Elu};
     }
 
     FORCE_INLINE ActivationFunction activationSwish() {
-      return {[](float x) { return x / (1.0f + std::exp(-x)); }, [](float y) { return y + (1.0f - y) * y; }};
+      return {[](float x) { return x / (1.0f + std::exp(-x)); }, [](float y) { return y + (1.0f - y) * y; }, ActivationKind::Swish};
     }
 
     FORCE_INLINE ActivationFunction activationSoftplus() {
-      return {[](float x) { return std::log1p(std::exp(x)); }, [](float y) { return 1.0f - std::exp(-y); }};
+      return {[](float x) { return std::log1p(std::exp(x)); }, [](float y) { return 1.0f - std::exp(-y); }, ActivationKind::Softplus};
     }
 
     FORCE_INLINE ActivationFunction activationHard_sigmoid() {
       return {[](float x) { return std::max(0.0f, std::min(1.0f, 0.2f * x + 0.5f)); },
-              [](float y) { return (y > 0.0f && y < 1.0f) ? 0.2f : 0.0f; }};
+              [](float y) { return (y > 0.0f && y < 1.0f) ? 0.2f : 0.0f; }, ActivationKind::HardSigmoid};
     }
 
     FORCE_INLINE ActivationFunction activationIdentity() {
-      return {[](float x) { return x; }, [](float) { return 1.0f; }};
+      return {[](float x) { return x; }, [](float) { return 1.0f; }, ActivationKind::Identity};
+    }
+
+    FORCE_INLINE ActivationFunction activation(ActivationKind kind) {
+      switch (kind) {
+      case ActivationKind::Identity: return activationIdentity();
+      case ActivationKind::Sigmoid: return activationSigmoid();
+      case ActivationKind::Relu: return activationRelu();
+      case ActivationKind::Tanh: return activationTanh_fn();
+      case ActivationKind::LeakyRelu: return activationLeaky_relu();
+      case ActivationKind::Elu: return activationElu();
+      case ActivationKind::Swish: return activationSwish();
+      case ActivationKind::Softplus: return activationSoftplus();
+      case ActivationKind::HardSigmoid: return activationHard_sigmoid();
+      case ActivationKind::Custom: break;
+      }
+
+      throw exception::NeuroException("Custom activations cannot be created from their kind");
+    }
+
+    FORCE_INLINE ActivationFunction activation(ActivationKind kind, ActivationPrecision precision) {
+      ActivationFunction function = activation(kind);
+      function.setPrecision(precision);
+
+      return function;
     }
 
   } // namespace maker
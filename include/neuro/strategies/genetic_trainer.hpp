@@ -1,24 +1,81 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "internal/attribute.hpp"
+#include "neuro/impl/population_arena.hpp"
 #include "neuro/interfaces/i_population.hpp"
 #include "neuro/strategies/i_strategy_evolution.hpp"
+#include "neuro/utils/crossover.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
+#include "neuro/utils/random.hpp"
+#include "neuro/utils/selection.hpp"
 
 namespace neuro {
 
   struct GeneticOptions {
+    // Share of parameters mutated, and the standard deviation of the zero-mean gaussian added to each of them.
     float rate = 0.5f;
     float intensity = 0.5f;
     size_t eliteCount = 5;
 
+    SelectionKind selection = SelectionKind::Tournament;
+
+    // Individuals drawn per tournament; the fittest of them becomes the parent.
+    size_t tournamentSize = 3;
+
+    // Expected draws of the fittest individual relative to the median under Rank selection, in [1, 2].
+    float rankPressure = 1.5f;
+
+    CrossoverOptions crossover{};
+
+    // Key of every random stream the trainer draws from; fix it to make runs reproducible.
+    uint64_t seed = globalSeed();
+
     bool operator!=(const GeneticOptions& other) const {
       return !(*this == other);
     }
 
     bool operator==(const GeneticOptions& other) const {
-      return rate == other.rate && intensity == other.intensity && eliteCount == other.eliteCount;
+      return rate == other.rate && intensity == other.intensity && eliteCount == other.eliteCount && selection == other.selection &&
+             tournamentSize == other.tournamentSize && rankPressure == other.rankPressure && crossover == other.crossover && seed == other.seed;
+    }
+  };
+
+  enum class ReplacementKind {
+    // A child replaces the least fit individual of the whole population, found in O(log n) through a
+    // min-heap that every insertion updates under one lock.
+    Worst,
+    // A child replaces the least fit of SteadyStateOptions::replacementTournament random individuals.
+    Tournament,
+  };
+
+  struct SteadyStateOptions {
+    ReplacementKind replacement = ReplacementKind::Worst;
+
+    size_t replacementTournament = 3;
+
+    // Concurrent workers on ThreadPool::global(); 0 uses every pool thread.
+    size_t threads = 0;
+
+    // Budget of each child's evaluation: the limits, timeoutFitness, cancellation and counters apply, the
+    // other fields do not. Children that run out of budget get timeoutFitness and are never inserted.
+    EvaluationOptions evaluation{};
+
+    bool operator!=(const SteadyStateOptions& other) const {
+      return !(*this == other);
+    }
+
+    bool operator==(const SteadyStateOptions& other) const {
+      return replacement == other.replacement && replacementTournament == other.replacementTournament && threads == other.threads &&
+             evaluation == other.evaluation;
     }
   };
 
@@ -28,9 +85,30 @@ namespace neuro {
 
     GeneticOptions options{};
 
+    // Advanced by every mutate() and evolve(); part of the random key so each round draws fresh values.
+    uint32_t generation = 0;
+
+   private:
+    // Generation scratch. Offspring are bred into the nursery and swapped into the population, so once warm
+    // a generation reuses the same individuals and performs no allocation.
+    std::vector<float> scores{};
+    std::vector<size_t> ranking{};
+    Selector selector{};
+    std::vector<std::shared_ptr<IIndividual>> nextGeneration{};
+    std::vector<std::shared_ptr<IIndividual>> nursery{};
+    PopulationArena offspring{};
+
+    // Steady-state scratch, grown to the largest population seen. Tournaments read slotFitness without
+    // locks; ReplacementKind::Worst keeps replacementHeap in step with it under replacementLock.
+    std::unique_ptr<std::atomic<float>[]> slotFitness{};
+    std::unique_ptr<std::mutex[]> slotLocks{};
+    size_t slotCapacity = 0;
+    std::vector<std::pair<float, size_t>> replacementHeap{};
+    std::mutex replacementLock{};
+
    public:
     GeneticTrainer();
-    GeneticTrainer(const GeneticTrainer&) = default;
+    GeneticTrainer(const GeneticTrainer&);
 
     GeneticTrainer(const std::shared_ptr<IPopulation>&);
     GeneticTrainer(const std::shared_ptr<IPopulation>&, float rate, float intensity = 0.5f, size_t eliteCount = 5);
@@ -38,10 +116,37 @@ namespace neuro {
 
     virtual ~GeneticTrainer() = default;
 
+    // One generation: the eliteCount fittest individuals survive unchanged and every other slot is
+    // replaced by a mutated child of two parents picked by GeneticOptions::selection. Fitness must be evaluated first.
     virtual void evolve();
 
+    // Same generation step on an arena. With equal seeds, topology and fitness it yields exactly the
+    // parameters evolve() produces on a Population.
+    virtual void evolve(PopulationArena& arena);
+
+    // Steady-state evolution: workers repeatedly breed one child from two tournament-selected parents,
+    // mutate and evaluate it, and insert it right away if it is at least as fit as the individual it
+    // replaces, so no worker waits for a generation barrier. Individuals are never modified once in the
+    // population, only swapped out under a per-slot lock, and tournaments read a lock-free fitness array.
+    // The best fitness never decreases. Selection is always a tournament of tournamentSize, and with more
+    // than one worker the outcome depends on scheduling. Fitness must be evaluated first. Returns the number
+    // of children inserted.
+    FORCE_INLINE size_t evolveSteadyState(size_t children,
+                                          const std::function<float(const INeuralNetwork&)>& evaluateFunction,
+                                          const SteadyStateOptions& steadyOptions = {}) {
+      return evolveSteadyState(
+        children, [&](const INeuralNetwork& network, EvaluationToken&) { return evaluateFunction(network); }, steadyOptions);
+    }
+
+    // Same, for cooperative fitness functions that poll their token; see SteadyStateOptions::evaluation.
+    virtual size_t evolveSteadyState(size_t children,
+                                     const std::function<float(const INeuralNetwork&, EvaluationToken&)>& evaluateFunction,
+                                     const SteadyStateOptions& steadyOptions = {});
+
     virtual void mutate();
 
+    // Selection, crossover (GeneticOptions::crossover) and replacement without mutation; children start with
+    // zero fitness.
     virtual void crossover();
 
     FORCE_INLINE std::shared_ptr<IPopulation> getPopulation() {
@@ -68,9 +173,43 @@ namespace neuro {
       options.eliteCount = eliteCount;
     }
 
+    FORCE_INLINE void setSelection(SelectionKind selection) {
+      options.selection = selection;
+    }
+
+    FORCE_INLINE void setRankPressure(float rankPressure) {
+      options.rankPressure = rankPressure;
+    }
+
+    FORCE_INLINE void setTournamentSize(size_t tournamentSize) {
+      options.tournamentSize = tournamentSize;
+    }
+
+    FORCE_INLINE void setCrossover(const CrossoverOptions& crossover) {
+      options.crossover = crossover;
+    }
+
+    FORCE_INLINE void setSeed(uint64_t seed) {
+      options.seed = seed;
+    }
+
+    FORCE_INLINE uint32_t getGeneration() const {
+      return generation;
+    }
+
+    FORCE_INLINE void setGeneration(uint32_t generation) {
+      this->generation = generation;
+    }
+
     FORCE_INLINE const GeneticOptions& getOptions() const {
       return options;
     }
+
+   private:
+    void mutateIndividuals(size_t begin);
+    void mutateIndividual(IIndividual& individual, const RandomKey& key) const;
+
+    void breed(const IIndividual& first, const IIndividual& second, IIndividual& child, const RandomKey& key) const;
   };
 
 } // namespace neuro
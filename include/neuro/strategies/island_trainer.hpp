@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "internal/attribute.hpp"
+#include "neuro/impl/population.hpp"
+#include "neuro/interfaces/i_individual.hpp"
+#include "neuro/interfaces/i_population.hpp"
+#include "neuro/strategies/genetic_trainer.hpp"
+#include "neuro/strategies/i_strategy_evolution.hpp"
+#include "neuro/utils/handoff_queue.hpp"
+
+namespace neuro {
+
+  enum class MigrationTopology {
+    // Island i sends to island i + 1, the last one to the first.
+    Ring,
+    // Every island sends to every other one.
+    FullyConnected,
+    // Each migration goes to one other island drawn at random.
+    Random,
+  };
+
+  struct IslandOptions {
+    // Per-island generation step; island i evolves with a seed derived from genetic.seed and i.
+    GeneticOptions genetic{};
+
+    MigrationTopology topology = MigrationTopology::Ring;
+
+    // Generations between migrations; 0 disables migration.
+    size_t migrationInterval = 10;
+
+    // Fittest individuals each island sends per migration. Arrivals replace the receiver's least fit.
+    size_t migrants = 2;
+
+    // Evaluation inside an island. Islands already run concurrently, so each uses one evaluator by default.
+    EvaluationOptions evaluation{1};
+
+    bool operator!=(const IslandOptions& other) const {
+      return !(*this == other);
+    }
+
+    bool operator==(const IslandOptions& other) const {
+      return genetic == other.genetic && topology == other.topology && migrationInterval == other.migrationInterval && migrants == other.migrants &&
+             evaluation == other.evaluation;
+    }
+  };
+
+  // Island-model genetic algorithm. Each island is a Population evolved by its own GeneticTrainer as one
+  // ThreadPool::global() task, with no barrier between islands. Every migrationInterval generations an
+  // island pushes copies of its fittest individuals into the lock-free inboxes of its topology neighbours
+  // and takes in whatever has arrived in its own; a full inbox drops the migrant. Islands never wait on
+  // each other, so which migrants arrive in time depends on scheduling and runs are not reproducible
+  // bit for bit once migration is enabled.
+  class IslandTrainer : public IStrategyEvolution {
+    using migrant_t = std::unique_ptr<IIndividual>;
+
+    std::vector<std::shared_ptr<Population>> islands{};
+    IslandOptions options{};
+
+    // Generations completed by every island so far.
+    uint32_t generation = 0;
+
+    std::vector<std::unique_ptr<GeneticTrainer>> trainers{};
+    std::vector<std::unique_ptr<HandoffQueue<migrant_t>>> inboxes{};
+
+    std::atomic<size_t> sentCount{0};
+    std::atomic<size_t> droppedCount{0};
+
+   public:
+    IslandTrainer(const std::vector<std::shared_ptr<Population>>& islands, const IslandOptions& options = {});
+
+    IslandTrainer(const IslandTrainer&) = delete;
+    IslandTrainer& operator=(const IslandTrainer&) = delete;
+
+    virtual ~IslandTrainer() = default;
+
+    // Runs generations generations on every island: evaluate, migrate when due, evolve. Fitness is evaluated
+    // once more at the end, so it is current when run returns. evaluateFunction is called concurrently.
+    void run(size_t generations, const std::function<float(const INeuralNetwork&)>& evaluateFunction);
+
+    // Fittest individual over all islands.
+    const IIndividual& getBestIndividual() const;
+
+    FORCE_INLINE const std::vector<std::shared_ptr<Population>>& getIslands() const {
+      return islands;
+    }
+
+    FORCE_INLINE size_t sizeIslands() const {
+      return islands.size();
+    }
+
+    FORCE_INLINE const IslandOptions& getOptions() const {
+      return options;
+    }
+
+    FORCE_INLINE uint32_t getGeneration() const {
+      return generation;
+    }
+
+    FORCE_INLINE size_t sentMigrants() const {
+      return sentCount.load(std::memory_order_relaxed);
+    }
+
+    FORCE_INLINE size_t droppedMigrants() const {
+      return droppedCount.load(std::memory_order_relaxed);
+    }
+
+   private:
+    void evolveIsland(size_t island, size_t generations, const std::function<float(const INeuralNetwork&)>& evaluateFunction);
+    void migrate(size_t island, uint32_t epoch);
+    void send(size_t island, size_t target, const std::vector<size_t>& fittest);
+  };
+
+} // namespace neuro
@@ -3,4 +3,5 @@
 #include "neuro/strategies/back_propagation_trainer.hpp"
 #include "neuro/strategies/genetic_trainer.hpp"
 #include "neuro/strategies/i_strategy_evolution.hpp"
+#include "neuro/strategies/island_trainer.hpp"
 #include "neuro/strategies/reinforcement_trainer.hpp"
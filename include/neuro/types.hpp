@@ -2,11 +2,20 @@
 
 #include <vector>
 
+#include "neuro/utils/matrix_view.hpp"
+#include "neuro/utils/weight_matrix.hpp"
+
 namespace neuro {
 
   typedef std::vector<float> neuro_layer_t;
 
-  typedef std::vector<neuro_layer_t> layer_weight_t;
+  typedef WeightMatrix layer_weight_t;
   typedef neuro_layer_t layer_bias_t;
 
+  typedef RowView<float> neuro_layer_span_t;
+  typedef RowView<const float> neuro_layer_const_span_t;
+
+  typedef MatrixView<float> layer_weight_view_t;
+  typedef MatrixView<const float> layer_weight_const_view_t;
+
 } // namespace neuro
@@ -1,15 +1,100 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <functional>
+#include <utility>
+
+#include "internal/attribute.hpp"
 
 namespace neuro {
 
   using ActivationHandler = std::function<float(float)>;
 
-  struct ActivationFunction {
-    ActivationHandler activate;
-    ActivationHandler derivate;
+  enum class ActivationKind {
+    Custom,
+    Identity,
+    Sigmoid,
+    Relu,
+    Tanh,
+    LeakyRelu,
+    Elu,
+    Swish,
+    Softplus,
+    HardSigmoid,
+  };
+
+  // Evaluation strategy of the transcendental kinds (sigmoid, tanh, elu, swish, softplus); the others are
+  // always exact. Worst-case error against Exact, absolute for sigmoid, tanh and elu and relative to
+  // max(1, |x|) for swish and softplus:
+  //   Fast:  vectorized polynomial exp/log, 1e-6
+  //   Table: linear interpolation over 2049 precomputed samples, 1e-5
+  enum class ActivationPrecision {
+    Exact,
+    Fast,
+    Table,
   };
 
+  // Scalar handlers plus the kind the vectorized kernels run in their place. Built-in kinds are applied
+  // over whole arrays by the kernels and Custom goes through the activate handler; replacing a handler
+  // turns the function Custom, so apply() and activate() can never run different code.
+  class ActivationFunction {
+    ActivationHandler activateHandler{};
+    ActivationHandler derivateHandler{};
+    ActivationKind kind = ActivationKind::Custom;
+    ActivationPrecision precision = ActivationPrecision::Exact;
+
+   public:
+    ActivationFunction() = default;
+
+    ActivationFunction(ActivationHandler activate, ActivationHandler derivate, ActivationKind kind = ActivationKind::Custom)
+      : activateHandler(std::move(activate)),
+        derivateHandler(std::move(derivate)),
+        kind(kind) {}
+
+    FORCE_INLINE float activate(float x) const {
+      return activateHandler(x);
+    }
+
+    FORCE_INLINE float derivate(float y) const {
+      return derivateHandler(y);
+    }
+
+    void apply(float* values, size_t size) const;
+
+    FORCE_INLINE const ActivationHandler& getActivate() const {
+      return activateHandler;
+    }
+
+    FORCE_INLINE const ActivationHandler& getDerivate() const {
+      return derivateHandler;
+    }
+
+    FORCE_INLINE void setActivate(ActivationHandler activate) {
+      activateHandler = std::move(activate);
+      kind = ActivationKind::Custom;
+    }
+
+    FORCE_INLINE void setDerivate(ActivationHandler derivate) {
+      derivateHandler = std::move(derivate);
+      kind = ActivationKind::Custom;
+    }
+
+    FORCE_INLINE ActivationKind getKind() const {
+      return kind;
+    }
+
+    FORCE_INLINE ActivationPrecision getPrecision() const {
+      return precision;
+    }
+
+    FORCE_INLINE void setPrecision(ActivationPrecision precision) {
+      this->precision = precision;
+    }
+  };
+
+  const char* activationName(ActivationKind kind);
+
+  bool isTranscendental(ActivationKind kind);
+
 } // namespace neuro
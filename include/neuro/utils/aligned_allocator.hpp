@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace neuro {
+
+  constexpr size_t DEFAULT_ALIGNMENT = 64;
+
+  template <typename T, size_t Alignment = DEFAULT_ALIGNMENT>
+  struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+      using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(size_t size) {
+      return static_cast<T*>(::operator new(size * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* pointer, size_t) noexcept {
+      ::operator delete(pointer, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+      return true;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept {
+      return false;
+    }
+  };
+
+  template <typename T>
+  using aligned_vector_t = std::vector<T, AlignedAllocator<T>>;
+
+} // namespace neuro
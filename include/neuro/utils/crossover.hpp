@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "internal/attribute.hpp"
+#include "neuro/utils/random.hpp"
+
+namespace neuro {
+
+  enum class CrossoverKind {
+    // Every parameter comes from either parent with equal probability.
+    Uniform,
+    // Parameters before one random cut come from the first parent, the rest from the second.
+    SinglePoint,
+    // Parents alternate at CrossoverOptions::points random cuts.
+    MultiPoint,
+    // first + alpha * (second - first), with one uniform alpha per child.
+    Blend,
+    // Simulated binary crossover (SBX) with CrossoverOptions::distributionIndex.
+    SimulatedBinary,
+  };
+
+  struct CrossoverOptions {
+    CrossoverKind kind = CrossoverKind::Uniform;
+
+    // Cut points of MultiPoint, at most Crossover::MAX_POINTS.
+    size_t points = 2;
+
+    // SBX spread: larger values keep children closer to their parents.
+    float distributionIndex = 15.0f;
+
+    bool operator!=(const CrossoverOptions& other) const {
+      return !(*this == other);
+    }
+
+    bool operator==(const CrossoverOptions& other) const {
+      return kind == other.kind && points == other.points && distributionIndex == other.distributionIndex;
+    }
+  };
+
+  // Recombines two flat genomes of genomeSize parameters into a child. A genome may be scattered over
+  // several buffers (each weight row and bias vector of a network): feed the segments to apply() in genome
+  // order and cut points land on the same genome positions however it is split.
+  class Crossover {
+   public:
+    static constexpr size_t MAX_POINTS = 32;
+
+   private:
+    CrossoverOptions options;
+    RandomStream& random;
+
+    std::array<size_t, MAX_POINTS> cuts{};
+    size_t cutCount = 0;
+    size_t nextCut = 0;
+    size_t position = 0;
+    float alpha = 0.5f;
+
+    // Random bits drawn but not used yet by Uniform, so the mask does not depend on segment boundaries.
+    uint32_t carry = 0;
+    uint32_t carryBits = 0;
+
+   public:
+    Crossover(const CrossoverOptions& options, size_t genomeSize, RandomStream& random);
+
+    // Writes the next size parameters of the child; child may alias either parent.
+    void apply(const float* first, const float* second, size_t size, float* child);
+
+    FORCE_INLINE size_t getPosition() const {
+      return position;
+    }
+
+   private:
+    void applyUniform(const float* first, const float* second, size_t size, float* child);
+    void applyPoints(const float* first, const float* second, size_t size, float* child);
+    void applySimulatedBinary(const float* first, const float* second, size_t size, float* child);
+  };
+
+} // namespace neuro
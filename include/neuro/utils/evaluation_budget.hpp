@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+#include "internal/attribute.hpp"
+
+namespace neuro {
+
+  enum class EvaluationOutcome {
+    Completed,
+    TimedOut,
+    Cancelled,
+  };
+
+  // Default fitness of evaluations that ran out of budget: finite, so differences and sums of fitness stay
+  // finite, and below any real score. Roulette selection gives it, and anything lower, no weight.
+  constexpr float TIMEOUT_FITNESS = -std::numeric_limits<float>::max() / 2;
+
+  // Shared stop flag; every token armed with it reports Cancelled once cancel() is called.
+  class CancellationSource {
+    std::atomic<bool> cancelled{false};
+
+   public:
+    CancellationSource() = default;
+
+    CancellationSource(const CancellationSource&) = delete;
+    CancellationSource& operator=(const CancellationSource&) = delete;
+
+    FORCE_INLINE void cancel() {
+      cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    FORCE_INLINE void reset() {
+      cancelled.store(false, std::memory_order_relaxed);
+    }
+
+    FORCE_INLINE bool isCancelled() const {
+      return cancelled.load(std::memory_order_relaxed);
+    }
+  };
+
+  // Budget of one evaluation, handed to cooperative fitness functions. They call step() once per
+  // simulation step and stop as soon as it returns false; the clock is only read every CLOCK_INTERVAL steps.
+  class EvaluationToken {
+    using clock_t = std::chrono::steady_clock;
+
+    clock_t::time_point deadline{};
+    bool hasDeadline = false;
+    size_t stepLimit = 0;
+    size_t stepCount = 0;
+    size_t untilClock = CLOCK_INTERVAL;
+    const CancellationSource* source = nullptr;
+    EvaluationOutcome state = EvaluationOutcome::Completed;
+
+   public:
+    static constexpr size_t CLOCK_INTERVAL = 16;
+
+    EvaluationToken() = default;
+
+    // A zero time or step limit means unlimited.
+    EvaluationToken(std::chrono::nanoseconds timeLimit, size_t stepLimit, const CancellationSource* cancellation = nullptr) {
+      arm(timeLimit, stepLimit, cancellation);
+    }
+
+    // Starts a new evaluation: the deadline counts from now and the step count restarts.
+    void arm(std::chrono::nanoseconds timeLimit, size_t stepLimit, const CancellationSource* cancellation = nullptr);
+
+    // Records steps and returns whether the evaluation may go on. A limit of n allows n steps.
+    FORCE_INLINE bool step(size_t steps = 1) {
+      stepCount += steps;
+
+      if (state != EvaluationOutcome::Completed) {
+        return false;
+      }
+
+      if (stepLimit != 0 && stepCount > stepLimit) {
+        state = EvaluationOutcome::TimedOut;
+        return false;
+      }
+
+      if (hasDeadline) {
+        untilClock -= std::min(untilClock, steps);
+
+        if (untilClock == 0) {
+          untilClock = CLOCK_INTERVAL;
+
+          if (clock_t::now() >= deadline) {
+            state = EvaluationOutcome::TimedOut;
+            return false;
+          }
+        }
+      }
+
+      if (source != nullptr && source->isCancelled()) {
+        state = EvaluationOutcome::Cancelled;
+        return false;
+      }
+
+      return true;
+    }
+
+    // Checks the clock and the cancellation source now, without counting a step.
+    bool shouldStop();
+
+    // Outcome once the fitness function returned. The deadline is checked once more, so functions that
+    // never look at the token are still caught when they overrun.
+    EvaluationOutcome finish();
+
+    FORCE_INLINE size_t steps() const {
+      return stepCount;
+    }
+
+    FORCE_INLINE EvaluationOutcome outcome() const {
+      return state;
+    }
+  };
+
+  // Outcomes of the evaluations run with EvaluationOptions::counters; safe to share between threads.
+  struct EvaluationCounters {
+    std::atomic<size_t> completed{0};
+    std::atomic<size_t> timedOut{0};
+    std::atomic<size_t> cancelled{0};
+
+    void record(EvaluationOutcome outcome, size_t count = 1);
+    void reset();
+
+    FORCE_INLINE size_t total() const {
+      return completed.load(std::memory_order_relaxed) + timedOut.load(std::memory_order_relaxed) + cancelled.load(std::memory_order_relaxed);
+    }
+  };
+
+} // namespace neuro
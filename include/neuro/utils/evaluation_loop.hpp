@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "neuro/utils/evaluation_budget.hpp"
+
+namespace neuro {
+
+  struct EvaluationOptions;
+
+  // Evaluates items [first, first + size) under token, writing their fitness as if they completed.
+  using evaluation_worker_t = std::function<void(size_t first, size_t size, EvaluationToken& token)>;
+
+  // Shared evaluation loop of the populations. Items [0, count) are claimed from a shared cursor in chunks
+  // of options.chunkSize rounded up to a multiple of unit, so a few slow items cannot leave the other
+  // evaluators idle, and each unit of up to `unit` items is run by one worker call under its own token.
+  // makeWorker is called once per evaluator, so workers may keep scratch state. Units cancelled before
+  // they start, timed out or cancelled while running are handed to penalize, and every item is recorded
+  // in options.counters. The first exception stops the other evaluators and is rethrown.
+  void runEvaluations(size_t count,
+                      size_t unit,
+                      const EvaluationOptions& options,
+                      const std::function<evaluation_worker_t()>& makeWorker,
+                      const std::function<void(size_t first, size_t size)>& penalize);
+
+} // namespace neuro
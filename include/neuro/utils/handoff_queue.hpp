@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "internal/attribute.hpp"
+
+namespace neuro {
+
+  // Bounded lock-free multi-producer multi-consumer queue (Vyukov). Each slot carries a sequence number
+  // telling producers and consumers whose turn it is, so tryPush and tryPop never block: they fail
+  // instead when the queue is full or empty.
+  template <typename T>
+  class HandoffQueue {
+    struct alignas(64) Slot {
+      std::atomic<size_t> sequence;
+      T value;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+
+   public:
+    // Capacity is rounded up to a power of two, at least 2.
+    explicit HandoffQueue(size_t capacity) {
+      size_t size = 2;
+
+      while (size < capacity) {
+        size <<= 1;
+      }
+
+      slots = std::make_unique<Slot[]>(size);
+      mask = size - 1;
+
+      for (size_t i = 0; i < size; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    HandoffQueue(const HandoffQueue&) = delete;
+    HandoffQueue& operator=(const HandoffQueue&) = delete;
+
+    bool tryPush(T&& value) {
+      size_t position = head.load(std::memory_order_relaxed);
+      Slot* slot;
+
+      for (;;) {
+        slot = &slots[position & mask];
+        const auto distance = static_cast<std::ptrdiff_t>(slot->sequence.load(std::memory_order_acquire) - position);
+
+        if (distance == 0) {
+          if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            break;
+          }
+        } else if (distance < 0) {
+          return false;
+        } else {
+          position = head.load(std::memory_order_relaxed);
+        }
+      }
+
+      slot->value = std::move(value);
+      slot->sequence.store(position + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    bool tryPop(T& value) {
+      size_t position = tail.load(std::memory_order_relaxed);
+      Slot* slot;
+
+      for (;;) {
+        slot = &slots[position & mask];
+        const auto distance = static_cast<std::ptrdiff_t>(slot->sequence.load(std::memory_order_acquire) - (position + 1));
+
+        if (distance == 0) {
+          if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            break;
+          }
+        } else if (distance < 0) {
+          return false;
+        } else {
+          position = tail.load(std::memory_order_relaxed);
+        }
+      }
+
+      value = std::move(slot->value);
+      slot->sequence.store(position + mask + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    FORCE_INLINE size_t capacity() const {
+      return mask + 1;
+    }
+  };
+
+} // namespace neuro
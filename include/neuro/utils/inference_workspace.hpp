@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+
+#include "internal/attribute.hpp"
+#include "neuro/utils/aligned_allocator.hpp"
+
+namespace neuro {
+
+  class InferenceWorkspace {
+    aligned_vector_t<float> front{};
+    aligned_vector_t<float> back{};
+
+   public:
+    InferenceWorkspace() = default;
+    InferenceWorkspace(size_t width);
+
+    void reserve(size_t width);
+
+    FORCE_INLINE size_t capacity() const {
+      return front.size();
+    }
+
+    FORCE_INLINE float* frontData() {
+      return front.data();
+    }
+
+    FORCE_INLINE float* backData() {
+      return back.data();
+    }
+
+    FORCE_INLINE void swap() {
+      front.swap(back);
+    }
+
+    static InferenceWorkspace& local();
+  };
+
+} // namespace neuro
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "internal/attribute.hpp"
+
+namespace neuro {
+
+  template <typename T>
+  class RowView {
+    T* values = nullptr;
+    size_t length = 0;
+
+   public:
+    RowView() = default;
+
+    RowView(T* values, size_t length)
+      : values(values),
+        length(length) {}
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+    RowView(const RowView<U>& other)
+      : values(other.data()),
+        length(other.size()) {}
+
+    template <typename Allocator>
+    RowView(std::vector<std::remove_const_t<T>, Allocator>& values)
+      : values(values.data()),
+        length(values.size()) {}
+
+    template <typename Allocator, typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+    RowView(const std::vector<std::remove_const_t<T>, Allocator>& values)
+      : values(values.data()),
+        length(values.size()) {}
+
+    FORCE_INLINE T* data() const {
+      return values;
+    }
+
+    FORCE_INLINE size_t size() const {
+      return length;
+    }
+
+    FORCE_INLINE bool empty() const {
+      return length == 0;
+    }
+
+    FORCE_INLINE T* begin() const {
+      return values;
+    }
+
+    FORCE_INLINE T* end() const {
+      return values + length;
+    }
+
+    FORCE_INLINE T& operator[](size_t index) const {
+      return values[index];
+    }
+  };
+
+  template <typename T>
+  class RowIterator {
+    T* values = nullptr;
+    size_t index = 0;
+    size_t length = 0;
+    size_t stride = 0;
+
+   public:
+    RowIterator(T* values, size_t index, size_t length, size_t stride)
+      : values(values),
+        index(index),
+        length(length),
+        stride(stride) {}
+
+    FORCE_INLINE RowView<T> operator*() const {
+      return {values + index * stride, length};
+    }
+
+    FORCE_INLINE RowIterator& operator++() {
+      index++;
+      return *this;
+    }
+
+    FORCE_INLINE bool operator==(const RowIterator& other) const {
+      return index == other.index;
+    }
+
+    FORCE_INLINE bool operator!=(const RowIterator& other) const {
+      return index != other.index;
+    }
+  };
+
+  template <typename T>
+  class MatrixView {
+    T* values = nullptr;
+    size_t rowCount = 0;
+    size_t colCount = 0;
+    size_t rowStride = 0;
+
+   public:
+    MatrixView() = default;
+
+    MatrixView(T* values, size_t rows, size_t cols, size_t stride)
+      : values(values),
+        rowCount(rows),
+        colCount(cols),
+        rowStride(stride) {}
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+    MatrixView(const MatrixView<U>& other)
+      : values(other.data()),
+        rowCount(other.rows()),
+        colCount(other.cols()),
+        rowStride(other.stride()) {}
+
+    FORCE_INLINE T* data() const {
+      return values;
+    }
+
+    FORCE_INLINE size_t rows() const {
+      return rowCount;
+    }
+
+    FORCE_INLINE size_t cols() const {
+      return colCount;
+    }
+
+    FORCE_INLINE size_t stride() const {
+      return rowStride;
+    }
+
+    FORCE_INLINE size_t size() const {
+      return rowCount;
+    }
+
+    FORCE_INLINE bool empty() const {
+      return rowCount == 0;
+    }
+
+    FORCE_INLINE RowView<T> row(size_t index) const {
+      return {values + index * rowStride, colCount};
+    }
+
+    FORCE_INLINE RowView<T> operator[](size_t index) const {
+      return row(index);
+    }
+
+    FORCE_INLINE RowIterator<T> begin() const {
+      return {values, 0, colCount, rowStride};
+    }
+
+    FORCE_INLINE RowIterator<T> end() const {
+      return {values, rowCount, colCount, rowStride};
+    }
+  };
+
+} // namespace neuro
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+
+#include "neuro/utils/random.hpp"
+
+namespace neuro {
+
+  // Adds normal(mean, stddev) noise to each of rows x cols parameters with probability rate. Rows start stride
+  // floats apart and the padding between them is never touched. The draws depend only on the logical
+  // positions, so a matrix mutated in place and the same values stored densely give identical results.
+  void mutateParameters(float* values, size_t rows, size_t cols, size_t stride, float rate, float mean, float stddev, RandomStream& random);
+
+} // namespace neuro
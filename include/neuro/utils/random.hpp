@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "internal/attribute.hpp"
+
+namespace neuro {
+
+  // Identifies the random streams of one individual in one generation; each layer derives its own stream.
+  struct RandomKey {
+    uint64_t seed = 0;
+    uint32_t generation = 0;
+    uint32_t individual = 0;
+  };
+
+  // Counter-based generator (Philox4x32-10). Every value is a pure function of the seed, the
+  // (generation, individual, layer) coordinates and its position in the stream, so streams can be created
+  // anywhere, on any thread, and always reproduce the same sequence. Satisfies UniformRandomBitGenerator,
+  // but uniform() and normal() should be preferred: standard distributions are not reproducible across
+  // standard library implementations.
+  class RandomStream {
+    std::array<uint32_t, 4> counter;
+    std::array<uint32_t, 2> key;
+    std::array<uint32_t, 4> block{};
+    size_t position = 4;
+
+    float spareNormal = 0.0f;
+    bool hasSpareNormal = false;
+
+   public:
+    using result_type = uint32_t;
+
+    // Layers use their index for weight streams; setting this bit selects the matching bias stream.
+    static constexpr uint32_t BIAS_STREAM = 0x80000000u;
+
+    RandomStream(uint64_t seed, uint32_t generation, uint32_t individual, uint32_t layer);
+    RandomStream(const RandomKey& key, uint32_t layer);
+
+    FORCE_INLINE uint32_t operator()() {
+      if (position == 4) {
+        refill();
+      }
+
+      return block[position++];
+    }
+
+    FORCE_INLINE uint64_t next64() {
+      const uint64_t high = (*this)();
+
+      return (high << 32) | (*this)();
+    }
+
+    // Uniform in [0, 1) with 24 bits of resolution.
+    FORCE_INLINE float uniform() {
+      return static_cast<float>((*this)() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    FORCE_INLINE float uniform(float min, float max) {
+      return min + (max - min) * uniform();
+    }
+
+    float normal(float mean, float stddev);
+
+    // Bulk draws: whole Philox blocks are generated by the SIMD kernels. fill and fillUniform yield exactly
+    // the values of the equivalent sequence of scalar calls.
+    void fill(uint32_t* output, size_t size);
+    void fillUniform(float* output, size_t size, float min, float max);
+
+    // Marsaglia polar method on batches of uniforms. Reproducible, but consumes the stream differently from
+    // repeated normal() calls.
+    void fillNormal(float* output, size_t size, float mean, float stddev);
+
+    static constexpr uint32_t min() {
+      return 0;
+    }
+
+    static constexpr uint32_t max() {
+      return std::numeric_limits<uint32_t>::max();
+    }
+
+    static std::array<uint32_t, 4> philox(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key);
+
+    // Stream private to the calling thread, keyed by the global seed and the order in which threads first
+    // asked for it. Restarts whenever setGlobalSeed is called.
+    static RandomStream& local();
+
+   private:
+    void refill();
+  };
+
+  uint64_t globalSeed();
+
+  void setGlobalSeed(uint64_t seed);
+
+} // namespace neuro
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "internal/attribute.hpp"
+#include "neuro/utils/random.hpp"
+
+namespace neuro {
+
+  enum class SelectionKind {
+    // Fittest of GeneticOptions::tournamentSize uniformly drawn individuals.
+    Tournament,
+    // Linear ranking: the fittest is drawn rankPressure times as often as the median, the least fit
+    // 2 - rankPressure times.
+    Rank,
+    // Probability proportional to fitness minus the lowest fitness. Non-finite entries and timed-out
+    // ones (at or below TIMEOUT_FITNESS) are never drawn and do not move the lowest fitness.
+    Roulette,
+  };
+
+  // Fills indices with 0..size-1 and moves the k fittest to the front, fittest first and ties by lower
+  // index; the order of the others is unspecified. O(size + k log k), reusing the capacity of indices.
+  void selectTop(const float* fitness, size_t size, size_t k, std::vector<size_t>& indices);
+
+  // Indices of the k fittest, fittest first.
+  std::vector<size_t> topK(const std::vector<float>& fitness, size_t k);
+
+  // Fittest of tournament contestants drawn with replacement, ties by lower index. O(tournament).
+  size_t tournamentSelect(const float* fitness, size_t size, size_t tournament, RandomStream& random);
+
+  // Walker/Vose alias table: built in O(n) from non-negative weights, then samples an index with
+  // probability proportional to its weight in O(1). All-zero or non-finite totals sample uniformly.
+  class AliasTable {
+    std::vector<float> probability{};
+    std::vector<uint32_t> alias{};
+    std::vector<uint32_t> small{};
+    std::vector<uint32_t> large{};
+
+   public:
+    AliasTable() = default;
+    explicit AliasTable(const std::vector<float>& weights);
+
+    // Reuses the storage of the previous table.
+    void build(const float* weights, size_t size);
+
+    FORCE_INLINE size_t sample(RandomStream& random) const {
+      const size_t index = (uint64_t(random()) * probability.size()) >> 32;
+
+      return random.uniform() < probability[index] ? index : alias[index];
+    }
+
+    FORCE_INLINE size_t size() const {
+      return probability.size();
+    }
+
+    FORCE_INLINE bool empty() const {
+      return probability.empty();
+    }
+  };
+
+  // Parent sampler over a compact fitness array, prepared once per generation. Tournament reads the array
+  // directly; Rank and Roulette precompute an alias table. The fitness array must outlive the sampling.
+  class Selector {
+    SelectionKind kind = SelectionKind::Tournament;
+    size_t tournament = 1;
+    const float* fitness = nullptr;
+    size_t count = 0;
+
+    AliasTable table{};
+    std::vector<float> weights{};
+    std::vector<size_t> order{};
+
+   public:
+    void prepare(SelectionKind kind, const float* fitness, size_t size, size_t tournamentSize, float rankPressure);
+
+    FORCE_INLINE size_t operator()(RandomStream& random) const {
+      return kind == SelectionKind::Tournament ? tournamentSelect(fitness, count, tournament, random) : table.sample(random);
+    }
+  };
+
+} // namespace neuro
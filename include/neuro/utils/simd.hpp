@@ -0,0 +1,19 @@
+#pragma once
+
+namespace neuro {
+
+  enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512,
+  };
+
+  SimdLevel detectSimdLevel();
+
+  SimdLevel getSimdLevel();
+
+  // Levels above what the CPU supports are clamped to detectSimdLevel().
+  void setSimdLevel(SimdLevel level);
+
+} // namespace neuro
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "internal/attribute.hpp"
+
+namespace neuro {
+
+  struct ThreadPoolOptions {
+    // Background workers; the thread calling parallelFor always takes part as well.
+    size_t workers = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+
+    // Pins worker i to core (i + 1) % cores, leaving core 0 to the caller. Only honoured on Linux.
+    bool pinThreads = false;
+  };
+
+  // Work-stealing executor shared by every parallel feature of the library. Each worker owns a deque of
+  // range tasks: it splits its range in halves, pushes the upper halves and keeps working on the lower one
+  // (LIFO), while idle workers steal the largest pending halves from the other end (FIFO).
+  class ThreadPool {
+    struct Job;
+
+    struct Task {
+      Job* job;
+      size_t begin;
+      size_t end;
+    };
+
+    // Double-ended ring of tasks. Unlike std::deque it keeps its storage when drained, so a warm pool
+    // schedules without allocating.
+    struct TaskRing {
+      std::vector<Task> slots{};
+      size_t head = 0;
+      size_t count = 0;
+
+      FORCE_INLINE bool empty() const {
+        return count == 0;
+      }
+
+      FORCE_INLINE Task& front() {
+        return slots[head];
+      }
+
+      FORCE_INLINE Task& back() {
+        return slots[(head + count - 1) % slots.size()];
+      }
+
+      FORCE_INLINE void pop_front() {
+        head = (head + 1) % slots.size();
+        count--;
+      }
+
+      FORCE_INLINE void pop_back() {
+        count--;
+      }
+
+      void push_back(const Task& task);
+    };
+
+    struct Queue {
+      std::mutex mutex{};
+      TaskRing tasks{};
+    };
+
+    std::vector<std::thread> workers{};
+    std::vector<std::unique_ptr<Queue>> queues{};
+    std::atomic<size_t> queued{0};
+    std::mutex sleepMutex{};
+    std::condition_variable available{};
+    bool stopping = false;
+
+   public:
+    explicit ThreadPool(size_t workers);
+    explicit ThreadPool(const ThreadPoolOptions& options);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool();
+
+    // Runs body over [0, count) in chunks of at least grain elements whose boundaries are multiples of
+    // grain, and blocks until every chunk finished. The first exception thrown by body is rethrown.
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t begin, size_t end)>& body);
+
+    FORCE_INLINE size_t size() const {
+      return workers.size();
+    }
+
+    FORCE_INLINE size_t concurrency() const {
+      return workers.size() + 1;
+    }
+
+    static ThreadPool& global();
+
+    // Replaces the global pool. Must not be called while any parallel work is running.
+    static void configureGlobal(const ThreadPoolOptions& options);
+
+   private:
+    size_t currentQueue() const;
+    void push(size_t queue, const Task& task);
+    bool tryPop(size_t queue, Task& task);
+    bool trySteal(size_t thief, Task& task);
+    bool runOne(size_t queue);
+    void execute(size_t queue, Task task);
+    void work(size_t index, bool pin);
+  };
+
+} // namespace neuro
@@ -1,3 +1,17 @@
 #pragma once
 
 #include "neuro/utils/activation.hpp"
+#include "neuro/utils/aligned_allocator.hpp"
+#include "neuro/utils/crossover.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
+#include "neuro/utils/evaluation_loop.hpp"
+#include "neuro/utils/handoff_queue.hpp"
+#include "neuro/utils/inference_workspace.hpp"
+#include "neuro/utils/matrix_view.hpp"
+#include "neuro/utils/mutation.hpp"
+#include "neuro/utils/random.hpp"
+#include "neuro/utils/selection.hpp"
+#include "neuro/utils/simd.hpp"
+#include "neuro/utils/thread_pool.hpp"
+#include "neuro/utils/version.hpp"
+#include "neuro/utils/weight_matrix.hpp"
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+#include "internal/attribute.hpp"
+
+namespace neuro {
+
+  // Stamp for a parameter change, unique within the process and never 0. Layers take a fresh stamp on
+  // every write and copies keep their source's, so an unchanged stamp means unchanged parameters.
+  uint64_t nextVersion();
+
+  // Order-dependent 64-bit combination (splitmix64 finalizer), for versions and genome hashes.
+  FORCE_INLINE uint64_t combineHash(uint64_t seed, uint64_t value) {
+    uint64_t x = seed ^ (value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2));
+
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+
+    return x ^ (x >> 31);
+  }
+
+} // namespace neuro
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+#include "internal/attribute.hpp"
+#include "neuro/utils/aligned_allocator.hpp"
+#include "neuro/utils/matrix_view.hpp"
+
+namespace neuro {
+
+  class WeightMatrix {
+    aligned_vector_t<float> values{};
+
+    size_t rowCount = 0;
+    size_t colCount = 0;
+    size_t rowStride = 0;
+
+   public:
+    static constexpr size_t STRIDE_ALIGNMENT = 8;
+
+    WeightMatrix() = default;
+
+    WeightMatrix(size_t rows, size_t cols);
+    WeightMatrix(std::initializer_list<std::initializer_list<float>> rows);
+    WeightMatrix(const std::vector<std::vector<float>>& rows);
+
+    void reshape(size_t rows, size_t cols);
+
+    void fill(float value);
+
+    std::vector<std::vector<float>> toVector() const;
+
+    FORCE_INLINE size_t rows() const {
+      return rowCount;
+    }
+
+    FORCE_INLINE size_t cols() const {
+      return colCount;
+    }
+
+    FORCE_INLINE size_t stride() const {
+      return rowStride;
+    }
+
+    FORCE_INLINE size_t size() const {
+      return rowCount;
+    }
+
+    FORCE_INLINE bool empty() const {
+      return rowCount == 0;
+    }
+
+    FORCE_INLINE float* data() {
+      return values.data();
+    }
+
+    FORCE_INLINE const float* data() const {
+      return values.data();
+    }
+
+    FORCE_INLINE MatrixView<float> view() {
+      return {values.data(), rowCount, colCount, rowStride};
+    }
+
+    FORCE_INLINE MatrixView<const float> view() const {
+      return {values.data(), rowCount, colCount, rowStride};
+    }
+
+    FORCE_INLINE RowView<float> row(size_t index) {
+      return {values.data() + index * rowStride, colCount};
+    }
+
+    FORCE_INLINE RowView<const float> row(size_t index) const {
+      return {values.data() + index * rowStride, colCount};
+    }
+
+    FORCE_INLINE RowView<float> operator[](size_t index) {
+      return row(index);
+    }
+
+    FORCE_INLINE RowView<const float> operator[](size_t index) const {
+      return row(index);
+    }
+
+    FORCE_INLINE RowIterator<float> begin() {
+      return view().begin();
+    }
+
+    FORCE_INLINE RowIterator<const float> begin() const {
+      return view().begin();
+    }
+
+    FORCE_INLINE RowIterator<float> end() {
+      return view().end();
+    }
+
+    FORCE_INLINE RowIterator<const float> end() const {
+      return view().end();
+    }
+
+    bool operator==(const WeightMatrix& other) const;
+
+    FORCE_INLINE bool operator!=(const WeightMatrix& other) const {
+      return !(*this == other);
+    }
+
+    static size_t alignedStride(size_t cols);
+  };
+
+} // namespace neuro
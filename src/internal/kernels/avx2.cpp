@@ -0,0 +1,408 @@
+#include "internal/attribute.hpp"
+#include "internal/fast_math.hpp"
+#include "internal/kernels.hpp"
+
+#ifdef NEURO_ARCH_X86
+
+#include <immintrin.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace neuro {
+
+  namespace kernel {
+
+    namespace {
+
+      TARGET_AVX2 FORCE_INLINE float horizontalSum(__m256 value) {
+        __m128 sums = _mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+        __m128 shuffled = _mm_movehdup_ps(sums);
+
+        sums = _mm_add_ps(sums, shuffled);
+        shuffled = _mm_movehl_ps(shuffled, sums);
+        sums = _mm_add_ss(sums, shuffled);
+
+        return _mm_cvtss_f32(sums);
+      }
+
+    } // namespace
+
+    TARGET_AVX2 void gemvAvx2(const float* weights, size_t stride, size_t rows, size_t cols, const float* input, const float* bias, float* output) {
+      const size_t vectorCols = cols & ~size_t(7);
+
+      size_t i = 0;
+
+      for (; i + 4 <= rows; i += 4) {
+        const float* row0 = weights + i * stride;
+        const float* row1 = row0 + stride;
+        const float* row2 = row1 + stride;
+        const float* row3 = row2 + stride;
+
+        __m256 acc0 = _mm256_setzero_ps();
+        __m256 acc1 = _mm256_setzero_ps();
+        __m256 acc2 = _mm256_setzero_ps();
+        __m256 acc3 = _mm256_setzero_ps();
+
+        for (size_t j = 0; j < vectorCols; j += 8) {
+          __m256 x = _mm256_loadu_ps(input + j);
+
+          acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(row0 + j), x, acc0);
+          acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(row1 + j), x, acc1);
+          acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(row2 + j), x, acc2);
+          acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(row3 + j), x, acc3);
+        }
+
+        float total0 = bias[i] + horizontalSum(acc0);
+        float total1 = bias[i + 1] + horizontalSum(acc1);
+        float total2 = bias[i + 2] + horizontalSum(acc2);
+        float total3 = bias[i + 3] + horizontalSum(acc3);
+
+        for (size_t j = vectorCols; j < cols; j++) {
+          total0 += row0[j] * input[j];
+          total1 += row1[j] * input[j];
+          total2 += row2[j] * input[j];
+          total3 += row3[j] * input[j];
+        }
+
+        output[i] = total0;
+        output[i + 1] = total1;
+        output[i + 2] = total2;
+        output[i + 3] = total3;
+      }
+
+      for (; i < rows; i++) {
+        const float* row = weights + i * stride;
+        __m256 acc = _mm256_setzero_ps();
+
+        for (size_t j = 0; j < vectorCols; j += 8) {
+          acc = _mm256_fmadd_ps(_mm256_loadu_ps(row + j), _mm256_loadu_ps(input + j), acc);
+        }
+
+        float total = bias[i] + horizontalSum(acc);
+
+        for (size_t j = vectorCols; j < cols; j++) {
+          total += row[j] * input[j];
+        }
+
+        output[i] = total;
+      }
+    }
+
+    namespace {
+
+      TARGET_AVX2 void gemmTileAvx2(const float* inputs, size_t inputStride, const float* weights, size_t stride, size_t cols, const float* bias, float* outputs, size_t outputStride) {
+        const size_t vectorCols = cols & ~size_t(7);
+
+        const float* input0 = inputs;
+        const float* input1 = input0 + inputStride;
+        const float* input2 = input1 + inputStride;
+        const float* input3 = input2 + inputStride;
+
+        const float* row0 = weights;
+        const float* row1 = weights + stride;
+
+        __m256 acc00 = _mm256_setzero_ps(), acc01 = _mm256_setzero_ps();
+        __m256 acc10 = _mm256_setzero_ps(), acc11 = _mm256_setzero_ps();
+        __m256 acc20 = _mm256_setzero_ps(), acc21 = _mm256_setzero_ps();
+        __m256 acc30 = _mm256_setzero_ps(), acc31 = _mm256_setzero_ps();
+
+        for (size_t j = 0; j < vectorCols; j += 8) {
+          __m256 w0 = _mm256_loadu_ps(row0 + j);
+          __m256 w1 = _mm256_loadu_ps(row1 + j);
+
+          __m256 x = _mm256_loadu_ps(input0 + j);
+          acc00 = _mm256_fmadd_ps(w0, x, acc00);
+          acc01 = _mm256_fmadd_ps(w1, x, acc01);
+
+          x = _mm256_loadu_ps(input1 + j);
+          acc10 = _mm256_fmadd_ps(w0, x, acc10);
+          acc11 = _mm256_fmadd_ps(w1, x, acc11);
+
+          x = _mm256_loadu_ps(input2 + j);
+          acc20 = _mm256_fmadd_ps(w0, x, acc20);
+          acc21 = _mm256_fmadd_ps(w1, x, acc21);
+
+          x = _mm256_loadu_ps(input3 + j);
+          acc30 = _mm256_fmadd_ps(w0, x, acc30);
+          acc31 = _mm256_fmadd_ps(w1, x, acc31);
+        }
+
+        float totals[8] = {
+          bias[0] + horizontalSum(acc00), bias[1] + horizontalSum(acc01),
+          bias[0] + horizontalSum(acc10), bias[1] + horizontalSum(acc11),
+          bias[0] + horizontalSum(acc20), bias[1] + horizontalSum(acc21),
+          bias[0] + horizontalSum(acc30), bias[1] + horizontalSum(acc31),
+        };
+
+        const float* sampleInputs[4] = {input0, input1, input2, input3};
+
+        for (size_t s = 0; s < 4; s++) {
+          for (size_t j = vectorCols; j < cols; j++) {
+            totals[s * 2] += row0[j] * sampleInputs[s][j];
+            totals[s * 2 + 1] += row1[j] * sampleInputs[s][j];
+          }
+
+          outputs[s * outputStride] = totals[s * 2];
+          outputs[s * outputStride + 1] = totals[s * 2 + 1];
+        }
+      }
+
+    } // namespace
+
+    TARGET_AVX2 void gemmAvx2(const float* weights, size_t stride, size_t rows, size_t cols, const float* inputs, size_t batch, const float* bias, float* outputs) {
+      gemmBlocked(gemmTileAvx2, gemvAvx2, weights, stride, rows, cols, inputs, batch, bias, outputs);
+    }
+
+    TARGET_AVX2 void activateAvx2(ActivationKind kind, float* values, size_t size) {
+      const size_t vectorSize = size & ~size_t(7);
+      const __m256 zero = _mm256_setzero_ps();
+
+      switch (kind) {
+      case ActivationKind::Relu:
+        for (size_t i = 0; i < vectorSize; i += 8) {
+          _mm256_storeu_ps(values + i, _mm256_max_ps(_mm256_loadu_ps(values + i), zero));
+        }
+        break;
+
+      case ActivationKind::LeakyRelu: {
+        const __m256 slope = _mm256_set1_ps(0.01f);
+
+        for (size_t i = 0; i < vectorSize; i += 8) {
+          __m256 x = _mm256_loadu_ps(values + i);
+
+          _mm256_storeu_ps(values + i, _mm256_blendv_ps(_mm256_mul_ps(x, slope), x, _mm256_cmp_ps(x, zero, _CMP_GT_OQ)));
+        }
+        break;
+      }
+
+      case ActivationKind::HardSigmoid: {
+        const __m256 slope = _mm256_set1_ps(0.2f);
+        const __m256 offset = _mm256_set1_ps(0.5f);
+        const __m256 one = _mm256_set1_ps(1.0f);
+
+        for (size_t i = 0; i < vectorSize; i += 8) {
+          __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(values + i), slope), offset);
+
+          _mm256_storeu_ps(values + i, _mm256_max_ps(_mm256_min_ps(x, one), zero));
+        }
+        break;
+      }
+
+      default:
+        activateScalar(kind, values, size);
+        return;
+      }
+
+      activateScalar(kind, values + vectorSize, size - vectorSize);
+    }
+
+    namespace {
+
+      TARGET_AVX2 FORCE_INLINE __m256 fastExp(__m256 x) {
+        x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(fast_math::EXP_MIN)), _mm256_set1_ps(fast_math::EXP_MAX));
+
+        const __m256 n = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(fast_math::LOG2E)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(fast_math::LN2_HI), x);
+        r = _mm256_fnmadd_ps(n, _mm256_set1_ps(fast_math::LN2_LO), r);
+
+        __m256 p = _mm256_set1_ps(fast_math::EXP_P0);
+        p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(fast_math::EXP_P1));
+        p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(fast_math::EXP_P2));
+        p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(fast_math::EXP_P3));
+        p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(fast_math::EXP_P4));
+        p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(fast_math::EXP_P5));
+
+        const __m256 y = _mm256_fmadd_ps(p, _mm256_mul_ps(r, r), _mm256_add_ps(r, _mm256_set1_ps(1.0f)));
+        const __m256i bits = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+
+        return _mm256_mul_ps(y, _mm256_castsi256_ps(bits));
+      }
+
+      TARGET_AVX2 FORCE_INLINE __m256 fastLog1pUnit(__m256 t) {
+        const __m256 halve = _mm256_cmp_ps(t, _mm256_set1_ps(fast_math::SQRT2_MINUS_ONE), _CMP_GT_OQ);
+        const __m256 numerator = _mm256_blendv_ps(t, _mm256_sub_ps(t, _mm256_set1_ps(1.0f)), halve);
+        const __m256 denominator = _mm256_add_ps(t, _mm256_blendv_ps(_mm256_set1_ps(2.0f), _mm256_set1_ps(3.0f), halve));
+        const __m256 s = _mm256_div_ps(numerator, denominator);
+        const __m256 s2 = _mm256_mul_ps(s, s);
+
+        __m256 p = _mm256_set1_ps(1.0f / 9.0f);
+        p = _mm256_fmadd_ps(p, s2, _mm256_set1_ps(1.0f / 7.0f));
+        p = _mm256_fmadd_ps(p, s2, _mm256_set1_ps(1.0f / 5.0f));
+        p = _mm256_fmadd_ps(p, s2, _mm256_set1_ps(1.0f / 3.0f));
+        p = _mm256_fmadd_ps(p, s2, _mm256_set1_ps(1.0f));
+
+        return _mm256_fmadd_ps(_mm256_add_ps(s, s), p, _mm256_and_ps(halve, _mm256_set1_ps(fast_math::LN2)));
+      }
+
+      TARGET_AVX2 FORCE_INLINE __m256 fastSigmoid(__m256 x) {
+        const __m256 one = _mm256_set1_ps(1.0f);
+
+        return _mm256_div_ps(one, _mm256_add_ps(one, fastExp(_mm256_sub_ps(_mm256_setzero_ps(), x))));
+      }
+
+      TARGET_AVX2 FORCE_INLINE __m256 fastTanh(__m256 x) {
+        const __m256 sign = _mm256_set1_ps(-0.0f);
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 magnitude = _mm256_andnot_ps(sign, x);
+        const __m256 t = _mm256_sub_ps(one, _mm256_div_ps(_mm256_set1_ps(2.0f), _mm256_add_ps(one, fastExp(_mm256_add_ps(magnitude, magnitude)))));
+
+        return _mm256_or_ps(t, _mm256_and_ps(sign, x));
+      }
+
+      TARGET_AVX2 FORCE_INLINE __m256 fastElu(__m256 x) {
+        const __m256 negative = _mm256_sub_ps(fastExp(x), _mm256_set1_ps(1.0f));
+
+        return _mm256_blendv_ps(negative, x, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GE_OQ));
+      }
+
+      TARGET_AVX2 FORCE_INLINE __m256 fastSwish(__m256 x) {
+        return _mm256_div_ps(x, _mm256_add_ps(_mm256_set1_ps(1.0f), fastExp(_mm256_sub_ps(_mm256_setzero_ps(), x))));
+      }
+
+      TARGET_AVX2 FORCE_INLINE __m256 fastSoftplus(__m256 x) {
+        const __m256 magnitude = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+
+        return _mm256_add_ps(_mm256_max_ps(x, _mm256_setzero_ps()), fastLog1pUnit(fastExp(_mm256_sub_ps(_mm256_setzero_ps(), magnitude))));
+      }
+
+      template <__m256 (*Operation)(__m256)>
+      TARGET_AVX2 void transformFast(ActivationKind kind, float* values, size_t size) {
+        const size_t vectorSize = size & ~size_t(7);
+
+        for (size_t i = 0; i < vectorSize; i += 8) {
+          _mm256_storeu_ps(values + i, Operation(_mm256_loadu_ps(values + i)));
+        }
+
+        activateFastScalar(kind, values + vectorSize, size - vectorSize);
+      }
+
+    } // namespace
+
+    namespace {
+
+      // 32x32 -> 64-bit products of every lane, split into their high and low halves.
+      TARGET_AVX2 FORCE_INLINE void multiplyHighLow(__m256i multiplier, __m256i value, __m256i& high, __m256i& low) {
+        const __m256i even = _mm256_mul_epu32(multiplier, value);
+        const __m256i odd = _mm256_mul_epu32(multiplier, _mm256_srli_epi64(value, 32));
+
+        low = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+        high = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+      }
+
+    } // namespace
+
+    TARGET_AVX2 void philoxAvx2(const uint32_t* counter, const uint32_t* key, size_t blocks, uint32_t* output) {
+      const size_t vectorBlocks = blocks & ~size_t(7);
+      const __m256i multiplier0 = _mm256_set1_epi32(static_cast<int>(0xD2511F53u));
+      const __m256i multiplier1 = _mm256_set1_epi32(static_cast<int>(0xCD9E8D57u));
+      const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+      for (size_t b = 0; b < vectorBlocks; b += 8) {
+        __m256i c0 = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(counter[0] + static_cast<uint32_t>(b))), lanes);
+        __m256i c1 = _mm256_set1_epi32(static_cast<int>(counter[1]));
+        __m256i c2 = _mm256_set1_epi32(static_cast<int>(counter[2]));
+        __m256i c3 = _mm256_set1_epi32(static_cast<int>(counter[3]));
+        uint32_t k0 = key[0];
+        uint32_t k1 = key[1];
+
+        for (int round = 0; round < 10; round++) {
+          __m256i high0, low0, high1, low1;
+
+          multiplyHighLow(multiplier0, c0, high0, low0);
+          multiplyHighLow(multiplier1, c2, high1, low1);
+
+          c0 = _mm256_xor_si256(_mm256_xor_si256(high1, c1), _mm256_set1_epi32(static_cast<int>(k0)));
+          c1 = low1;
+          c2 = _mm256_xor_si256(_mm256_xor_si256(high0, c3), _mm256_set1_epi32(static_cast<int>(k1)));
+          c3 = low0;
+
+          k0 += 0x9E3779B9u;
+          k1 += 0xBB67AE85u;
+        }
+
+        const __m256i t0 = _mm256_unpacklo_epi32(c0, c1);
+        const __m256i t1 = _mm256_unpackhi_epi32(c0, c1);
+        const __m256i t2 = _mm256_unpacklo_epi32(c2, c3);
+        const __m256i t3 = _mm256_unpackhi_epi32(c2, c3);
+
+        const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+        const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+        const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+        const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+
+        __m256i* target = reinterpret_cast<__m256i*>(output + b * 4);
+
+        _mm256_storeu_si256(target, _mm256_permute2x128_si256(u0, u1, 0x20));
+        _mm256_storeu_si256(target + 1, _mm256_permute2x128_si256(u2, u3, 0x20));
+        _mm256_storeu_si256(target + 2, _mm256_permute2x128_si256(u0, u1, 0x31));
+        _mm256_storeu_si256(target + 3, _mm256_permute2x128_si256(u2, u3, 0x31));
+      }
+
+      const uint32_t tailCounter[4] = {counter[0] + static_cast<uint32_t>(vectorBlocks), counter[1], counter[2], counter[3]};
+
+      philoxScalar(tailCounter, key, blocks - vectorBlocks, output + vectorBlocks * 4);
+    }
+
+    TARGET_AVX2 void activateFastAvx2(ActivationKind kind, float* values, size_t size) {
+      switch (kind) {
+      case ActivationKind::Sigmoid: transformFast<fastSigmoid>(kind, values, size); break;
+      case ActivationKind::Tanh: transformFast<fastTanh>(kind, values, size); break;
+      case ActivationKind::Elu: transformFast<fastElu>(kind, values, size); break;
+      case ActivationKind::Swish: transformFast<fastSwish>(kind, values, size); break;
+      case ActivationKind::Softplus: transformFast<fastSoftplus>(kind, values, size); break;
+      default: activateAvx2(kind, values, size); break;
+      }
+    }
+
+    TARGET_AVX2 void selectAvx2(const float* first, const float* second, const uint32_t* mask, size_t size, float* child) {
+      const size_t vectorSize = size & ~size_t(7);
+      const __m256i lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+
+      for (size_t i = 0; i < vectorSize; i += 8) {
+        const __m256i bits = _mm256_set1_epi32(static_cast<int>((mask[i / 32] >> (i % 32)) & 0xFFu));
+        const __m256 selected = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(bits, lanes), lanes));
+
+        _mm256_storeu_ps(child + i, _mm256_blendv_ps(_mm256_loadu_ps(first + i), _mm256_loadu_ps(second + i), selected));
+      }
+
+      for (size_t i = vectorSize; i < size; i++) {
+        child[i] = (mask[i / 32] >> (i % 32)) & 1u ? second[i] : first[i];
+      }
+    }
+
+    TARGET_AVX2 void blendAvx2(const float* first, const float* second, float alpha, size_t size, float* child) {
+      const size_t vectorSize = size & ~size_t(7);
+      const __m256 factor = _mm256_set1_ps(alpha);
+
+      for (size_t i = 0; i < vectorSize; i += 8) {
+        const __m256 a = _mm256_loadu_ps(first + i);
+        const __m256 product = _mm256_mul_ps(factor, _mm256_sub_ps(_mm256_loadu_ps(second + i), a));
+
+        _mm256_storeu_ps(child + i, _mm256_add_ps(a, product));
+      }
+
+      blendScalar(first + vectorSize, second + vectorSize, alpha, size - vectorSize, child + vectorSize);
+    }
+
+    TARGET_AVX2 void laneGemvAvx2(const float* weights, size_t rows, size_t cols, const float* inputs, const float* bias, float* outputs) {
+      for (size_t i = 0; i < rows; i++) {
+        const float* row = weights + i * cols * LANES;
+        __m256 low = _mm256_loadu_ps(bias + i * LANES);
+        __m256 high = _mm256_loadu_ps(bias + i * LANES + 8);
+
+        for (size_t j = 0; j < cols; j++) {
+          low = _mm256_add_ps(low, _mm256_mul_ps(_mm256_loadu_ps(row + j * LANES), _mm256_loadu_ps(inputs + j * LANES)));
+          high = _mm256_add_ps(high, _mm256_mul_ps(_mm256_loadu_ps(row + j * LANES + 8), _mm256_loadu_ps(inputs + j * LANES + 8)));
+        }
+
+        _mm256_storeu_ps(outputs + i * LANES, low);
+        _mm256_storeu_ps(outputs + i * LANES + 8, high);
+      }
+    }
+
+  } // namespace kernel
+
+} // namespace neuro
+
+#endif
@@ -0,0 +1,386 @@
+#include "internal/attribute.hpp"
+#include "internal/fast_math.hpp"
+#include "internal/kernels.hpp"
+
+#ifdef NEURO_ARCH_X86
+
+#include <immintrin.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace neuro {
+
+  namespace kernel {
+
+    TARGET_AVX512 void gemvAvx512(const float* weights, size_t stride, size_t rows, size_t cols, const float* input, const float* bias, float* output) {
+      const size_t vectorCols = cols & ~size_t(15);
+      const __mmask16 tailMask = static_cast<__mmask16>((1u << (cols - vectorCols)) - 1u);
+      const __m512 tailInput = _mm512_maskz_loadu_ps(tailMask, input + vectorCols);
+
+      size_t i = 0;
+
+      for (; i + 4 <= rows; i += 4) {
+        const float* row0 = weights + i * stride;
+        const float* row1 = row0 + stride;
+        const float* row2 = row1 + stride;
+        const float* row3 = row2 + stride;
+
+        __m512 acc0 = _mm512_setzero_ps();
+        __m512 acc1 = _mm512_setzero_ps();
+        __m512 acc2 = _mm512_setzero_ps();
+        __m512 acc3 = _mm512_setzero_ps();
+
+        for (size_t j = 0; j < vectorCols; j += 16) {
+          __m512 x = _mm512_loadu_ps(input + j);
+
+          acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(row0 + j), x, acc0);
+          acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(row1 + j), x, acc1);
+          acc2 = _mm512_fmadd_ps(_mm512_loadu_ps(row2 + j), x, acc2);
+          acc3 = _mm512_fmadd_ps(_mm512_loadu_ps(row3 + j), x, acc3);
+        }
+
+        if (tailMask) {
+          acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tailMask, row0 + vectorCols), tailInput, acc0);
+          acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tailMask, row1 + vectorCols), tailInput, acc1);
+          acc2 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tailMask, row2 + vectorCols), tailInput, acc2);
+          acc3 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tailMask, row3 + vectorCols), tailInput, acc3);
+        }
+
+        output[i] = bias[i] + _mm512_reduce_add_ps(acc0);
+        output[i + 1] = bias[i + 1] + _mm512_reduce_add_ps(acc1);
+        output[i + 2] = bias[i + 2] + _mm512_reduce_add_ps(acc2);
+        output[i + 3] = bias[i + 3] + _mm512_reduce_add_ps(acc3);
+      }
+
+      for (; i < rows; i++) {
+        const float* row = weights + i * stride;
+        __m512 acc = _mm512_setzero_ps();
+
+        for (size_t j = 0; j < vectorCols; j += 16) {
+          acc = _mm512_fmadd_ps(_mm512_loadu_ps(row + j), _mm512_loadu_ps(input + j), acc);
+        }
+
+        if (tailMask) {
+          acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tailMask, row + vectorCols), tailInput, acc);
+        }
+
+        output[i] = bias[i] + _mm512_reduce_add_ps(acc);
+      }
+    }
+
+    namespace {
+
+      TARGET_AVX512 void gemmTileAvx512(const float* inputs, size_t inputStride, const float* weights, size_t stride, size_t cols, const float* bias, float* outputs, size_t outputStride) {
+        const size_t vectorCols = cols & ~size_t(15);
+        const __mmask16 tailMask = static_cast<__mmask16>((1u << (cols - vectorCols)) - 1u);
+
+        const float* input0 = inputs;
+        const float* input1 = input0 + inputStride;
+        const float* input2 = input1 + inputStride;
+        const float* input3 = input2 + inputStride;
+
+        const float* row0 = weights;
+        const float* row1 = weights + stride;
+
+        __m512 acc00 = _mm512_setzero_ps(), acc01 = _mm512_setzero_ps();
+        __m512 acc10 = _mm512_setzero_ps(), acc11 = _mm512_setzero_ps();
+        __m512 acc20 = _mm512_setzero_ps(), acc21 = _mm512_setzero_ps();
+        __m512 acc30 = _mm512_setzero_ps(), acc31 = _mm512_setzero_ps();
+
+        for (size_t j = 0; j < vectorCols + (tailMask ? 16 : 0); j += 16) {
+          const __mmask16 mask = j < vectorCols ? static_cast<__mmask16>(0xFFFF) : tailMask;
+
+          __m512 w0 = _mm512_maskz_loadu_ps(mask, row0 + j);
+          __m512 w1 = _mm512_maskz_loadu_ps(mask, row1 + j);
+
+          __m512 x = _mm512_maskz_loadu_ps(mask, input0 + j);
+          acc00 = _mm512_fmadd_ps(w0, x, acc00);
+          acc01 = _mm512_fmadd_ps(w1, x, acc01);
+
+          x = _mm512_maskz_loadu_ps(mask, input1 + j);
+          acc10 = _mm512_fmadd_ps(w0, x, acc10);
+          acc11 = _mm512_fmadd_ps(w1, x, acc11);
+
+          x = _mm512_maskz_loadu_ps(mask, input2 + j);
+          acc20 = _mm512_fmadd_ps(w0, x, acc20);
+          acc21 = _mm512_fmadd_ps(w1, x, acc21);
+
+          x = _mm512_maskz_loadu_ps(mask, input3 + j);
+          acc30 = _mm512_fmadd_ps(w0, x, acc30);
+          acc31 = _mm512_fmadd_ps(w1, x, acc31);
+        }
+
+        outputs[0] = bias[0] + _mm512_reduce_add_ps(acc00);
+        outputs[1] = bias[1] + _mm512_reduce_add_ps(acc01);
+        outputs[outputStride] = bias[0] + _mm512_reduce_add_ps(acc10);
+        outputs[outputStride + 1] = bias[1] + _mm512_reduce_add_ps(acc11);
+        outputs[2 * outputStride] = bias[0] + _mm512_reduce_add_ps(acc20);
+        outputs[2 * outputStride + 1] = bias[1] + _mm512_reduce_add_ps(acc21);
+        outputs[3 * outputStride] = bias[0] + _mm512_reduce_add_ps(acc30);
+        outputs[3 * outputStride + 1] = bias[1] + _mm512_reduce_add_ps(acc31);
+      }
+
+    } // namespace
+
+    TARGET_AVX512 void gemmAvx512(const float* weights, size_t stride, size_t rows, size_t cols, const float* inputs, size_t batch, const float* bias, float* outputs) {
+      gemmBlocked(gemmTileAvx512, gemvAvx512, weights, stride, rows, cols, inputs, batch, bias, outputs);
+    }
+
+    TARGET_AVX512 void activateAvx512(ActivationKind kind, float* values, size_t size) {
+      const size_t vectorSize = size & ~size_t(15);
+      const __mmask16 tailMask = static_cast<__mmask16>((1u << (size - vectorSize)) - 1u);
+      const __m512 zero = _mm512_setzero_ps();
+
+      switch (kind) {
+      case ActivationKind::Relu:
+        for (size_t i = 0; i < vectorSize; i += 16) {
+          _mm512_storeu_ps(values + i, _mm512_max_ps(_mm512_loadu_ps(values + i), zero));
+        }
+
+        _mm512_mask_storeu_ps(values + vectorSize, tailMask, _mm512_max_ps(_mm512_maskz_loadu_ps(tailMask, values + vectorSize), zero));
+        break;
+
+      case ActivationKind::LeakyRelu: {
+        const __m512 slope = _mm512_set1_ps(0.01f);
+
+        for (size_t i = 0; i < size; i += 16) {
+          const __mmask16 mask = i < vectorSize ? static_cast<__mmask16>(0xFFFF) : tailMask;
+          __m512 x = _mm512_maskz_loadu_ps(mask, values + i);
+          __mmask16 positive = _mm512_cmp_ps_mask(x, zero, _CMP_GT_OQ);
+
+          _mm512_mask_storeu_ps(values + i, mask, _mm512_mask_blend_ps(positive, _mm512_mul_ps(x, slope), x));
+        }
+        break;
+      }
+
+      case ActivationKind::HardSigmoid: {
+        const __m512 slope = _mm512_set1_ps(0.2f);
+        const __m512 offset = _mm512_set1_ps(0.5f);
+        const __m512 one = _mm512_set1_ps(1.0f);
+
+        for (size_t i = 0; i < size; i += 16) {
+          const __mmask16 mask = i < vectorSize ? static_cast<__mmask16>(0xFFFF) : tailMask;
+          __m512 x = _mm512_add_ps(_mm512_mul_ps(_mm512_maskz_loadu_ps(mask, values + i), slope), offset);
+
+          _mm512_mask_storeu_ps(values + i, mask, _mm512_max_ps(_mm512_min_ps(x, one), zero));
+        }
+        break;
+      }
+
+      default:
+        activateScalar(kind, values, size);
+        break;
+      }
+    }
+
+    namespace {
+
+      TARGET_AVX512 FORCE_INLINE __m512 fastExp(__m512 x) {
+        x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(fast_math::EXP_MIN)), _mm512_set1_ps(fast_math::EXP_MAX));
+
+        const __m512 n = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(fast_math::LOG2E)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(fast_math::LN2_HI), x);
+        r = _mm512_fnmadd_ps(n, _mm512_set1_ps(fast_math::LN2_LO), r);
+
+        __m512 p = _mm512_set1_ps(fast_math::EXP_P0);
+        p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(fast_math::EXP_P1));
+        p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(fast_math::EXP_P2));
+        p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(fast_math::EXP_P3));
+        p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(fast_math::EXP_P4));
+        p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(fast_math::EXP_P5));
+
+        const __m512 y = _mm512_fmadd_ps(p, _mm512_mul_ps(r, r), _mm512_add_ps(r, _mm512_set1_ps(1.0f)));
+        const __m512i bits = _mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(n), _mm512_set1_epi32(127)), 23);
+
+        return _mm512_mul_ps(y, _mm512_castsi512_ps(bits));
+      }
+
+      TARGET_AVX512 FORCE_INLINE __m512 fastLog1pUnit(__m512 t) {
+        const __mmask16 halve = _mm512_cmp_ps_mask(t, _mm512_set1_ps(fast_math::SQRT2_MINUS_ONE), _CMP_GT_OQ);
+        const __m512 numerator = _mm512_mask_sub_ps(t, halve, t, _mm512_set1_ps(1.0f));
+        const __m512 denominator = _mm512_add_ps(t, _mm512_mask_blend_ps(halve, _mm512_set1_ps(2.0f), _mm512_set1_ps(3.0f)));
+        const __m512 s = _mm512_div_ps(numerator, denominator);
+        const __m512 s2 = _mm512_mul_ps(s, s);
+
+        __m512 p = _mm512_set1_ps(1.0f / 9.0f);
+        p = _mm512_fmadd_ps(p, s2, _mm512_set1_ps(1.0f / 7.0f));
+        p = _mm512_fmadd_ps(p, s2, _mm512_set1_ps(1.0f / 5.0f));
+        p = _mm512_fmadd_ps(p, s2, _mm512_set1_ps(1.0f / 3.0f));
+        p = _mm512_fmadd_ps(p, s2, _mm512_set1_ps(1.0f));
+
+        return _mm512_fmadd_ps(_mm512_add_ps(s, s), p, _mm512_maskz_mov_ps(halve, _mm512_set1_ps(fast_math::LN2)));
+      }
+
+      TARGET_AVX512 FORCE_INLINE __m512 fastSigmoid(__m512 x) {
+        const __m512 one = _mm512_set1_ps(1.0f);
+
+        return _mm512_div_ps(one, _mm512_add_ps(one, fastExp(_mm512_sub_ps(_mm512_setzero_ps(), x))));
+      }
+
+      TARGET_AVX512 FORCE_INLINE __m512 fastTanh(__m512 x) {
+        const __m512i sign = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+        const __m512 one = _mm512_set1_ps(1.0f);
+        const __m512 magnitude = _mm512_abs_ps(x);
+        const __m512 t = _mm512_sub_ps(one, _mm512_div_ps(_mm512_set1_ps(2.0f), _mm512_add_ps(one, fastExp(_mm512_add_ps(magnitude, magnitude)))));
+
+        return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(t), _mm512_and_si512(sign, _mm512_castps_si512(x))));
+      }
+
+      TARGET_AVX512 FORCE_INLINE __m512 fastElu(__m512 x) {
+        const __m512 negative = _mm512_sub_ps(fastExp(x), _mm512_set1_ps(1.0f));
+
+        return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_GE_OQ), negative, x);
+      }
+
+      TARGET_AVX512 FORCE_INLINE __m512 fastSwish(__m512 x) {
+        return _mm512_div_ps(x, _mm512_add_ps(_mm512_set1_ps(1.0f), fastExp(_mm512_sub_ps(_mm512_setzero_ps(), x))));
+      }
+
+      TARGET_AVX512 FORCE_INLINE __m512 fastSoftplus(__m512 x) {
+        const __m512 magnitude = _mm512_abs_ps(x);
+
+        return _mm512_add_ps(_mm512_max_ps(x, _mm512_setzero_ps()), fastLog1pUnit(fastExp(_mm512_sub_ps(_mm512_setzero_ps(), magnitude))));
+      }
+
+      template <__m512 (*Operation)(__m512)>
+      TARGET_AVX512 void transformFast(float* values, size_t size) {
+        const size_t vectorSize = size & ~size_t(15);
+        const __mmask16 tailMask = static_cast<__mmask16>((1u << (size - vectorSize)) - 1u);
+
+        for (size_t i = 0; i < vectorSize; i += 16) {
+          _mm512_storeu_ps(values + i, Operation(_mm512_loadu_ps(values + i)));
+        }
+
+        _mm512_mask_storeu_ps(values + vectorSize, tailMask, Operation(_mm512_maskz_loadu_ps(tailMask, values + vectorSize)));
+      }
+
+    } // namespace
+
+    namespace {
+
+      TARGET_AVX512 FORCE_INLINE void multiplyHighLow(__m512i multiplier, __m512i value, __m512i& high, __m512i& low) {
+        const __m512i even = _mm512_mul_epu32(multiplier, value);
+        const __m512i odd = _mm512_mul_epu32(multiplier, _mm512_srli_epi64(value, 32));
+
+        low = _mm512_mask_blend_epi32(0xAAAA, even, _mm512_slli_epi64(odd, 32));
+        high = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd);
+      }
+
+    } // namespace
+
+    TARGET_AVX512 void philoxAvx512(const uint32_t* counter, const uint32_t* key, size_t blocks, uint32_t* output) {
+      const size_t vectorBlocks = blocks & ~size_t(15);
+      const __m512i multiplier0 = _mm512_set1_epi32(static_cast<int>(0xD2511F53u));
+      const __m512i multiplier1 = _mm512_set1_epi32(static_cast<int>(0xCD9E8D57u));
+      const __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+      for (size_t b = 0; b < vectorBlocks; b += 16) {
+        __m512i c0 = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(counter[0] + static_cast<uint32_t>(b))), lanes);
+        __m512i c1 = _mm512_set1_epi32(static_cast<int>(counter[1]));
+        __m512i c2 = _mm512_set1_epi32(static_cast<int>(counter[2]));
+        __m512i c3 = _mm512_set1_epi32(static_cast<int>(counter[3]));
+        uint32_t k0 = key[0];
+        uint32_t k1 = key[1];
+
+        for (int round = 0; round < 10; round++) {
+          __m512i high0, low0, high1, low1;
+
+          multiplyHighLow(multiplier0, c0, high0, low0);
+          multiplyHighLow(multiplier1, c2, high1, low1);
+
+          c0 = _mm512_xor_si512(_mm512_xor_si512(high1, c1), _mm512_set1_epi32(static_cast<int>(k0)));
+          c1 = low1;
+          c2 = _mm512_xor_si512(_mm512_xor_si512(high0, c3), _mm512_set1_epi32(static_cast<int>(k1)));
+          c3 = low0;
+
+          k0 += 0x9E3779B9u;
+          k1 += 0xBB67AE85u;
+        }
+
+        // Within each 128-bit lane j, u0..u3 hold blocks 4j..4j+3; the shuffles transpose the lanes.
+        const __m512i t0 = _mm512_unpacklo_epi32(c0, c1);
+        const __m512i t1 = _mm512_unpackhi_epi32(c0, c1);
+        const __m512i t2 = _mm512_unpacklo_epi32(c2, c3);
+        const __m512i t3 = _mm512_unpackhi_epi32(c2, c3);
+
+        const __m512i u0 = _mm512_unpacklo_epi64(t0, t2);
+        const __m512i u1 = _mm512_unpackhi_epi64(t0, t2);
+        const __m512i u2 = _mm512_unpacklo_epi64(t1, t3);
+        const __m512i u3 = _mm512_unpackhi_epi64(t1, t3);
+
+        const __m512i low01 = _mm512_shuffle_i32x4(u0, u1, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m512i low23 = _mm512_shuffle_i32x4(u2, u3, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m512i high01 = _mm512_shuffle_i32x4(u0, u1, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m512i high23 = _mm512_shuffle_i32x4(u2, u3, _MM_SHUFFLE(3, 2, 3, 2));
+
+        uint32_t* target = output + b * 4;
+
+        _mm512_storeu_si512(target, _mm512_shuffle_i32x4(low01, low23, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm512_storeu_si512(target + 16, _mm512_shuffle_i32x4(low01, low23, _MM_SHUFFLE(3, 1, 3, 1)));
+        _mm512_storeu_si512(target + 32, _mm512_shuffle_i32x4(high01, high23, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm512_storeu_si512(target + 48, _mm512_shuffle_i32x4(high01, high23, _MM_SHUFFLE(3, 1, 3, 1)));
+      }
+
+      const uint32_t tailCounter[4] = {counter[0] + static_cast<uint32_t>(vectorBlocks), counter[1], counter[2], counter[3]};
+
+      philoxScalar(tailCounter, key, blocks - vectorBlocks, output + vectorBlocks * 4);
+    }
+
+    TARGET_AVX512 void activateFastAvx512(ActivationKind kind, float* values, size_t size) {
+      switch (kind) {
+      case ActivationKind::Sigmoid: transformFast<fastSigmoid>(values, size); break;
+      case ActivationKind::Tanh: transformFast<fastTanh>(values, size); break;
+      case ActivationKind::Elu: transformFast<fastElu>(values, size); break;
+      case ActivationKind::Swish: transformFast<fastSwish>(values, size); break;
+      case ActivationKind::Softplus: transformFast<fastSoftplus>(values, size); break;
+      default: activateAvx512(kind, values, size); break;
+      }
+    }
+
+    TARGET_AVX512 void selectAvx512(const float* first, const float* second, const uint32_t* mask, size_t size, float* child) {
+      const size_t vectorSize = size & ~size_t(15);
+
+      for (size_t i = 0; i < vectorSize; i += 16) {
+        const __mmask16 selected = static_cast<__mmask16>(mask[i / 32] >> (i % 32));
+
+        _mm512_storeu_ps(child + i, _mm512_mask_blend_ps(selected, _mm512_loadu_ps(first + i), _mm512_loadu_ps(second + i)));
+      }
+
+      for (size_t i = vectorSize; i < size; i++) {
+        child[i] = (mask[i / 32] >> (i % 32)) & 1u ? second[i] : first[i];
+      }
+    }
+
+    TARGET_AVX512 void blendAvx512(const float* first, const float* second, float alpha, size_t size, float* child) {
+      const size_t vectorSize = size & ~size_t(15);
+      const __m512 factor = _mm512_set1_ps(alpha);
+
+      for (size_t i = 0; i < vectorSize; i += 16) {
+        const __m512 a = _mm512_loadu_ps(first + i);
+        const __m512 product = _mm512_mul_ps(factor, _mm512_sub_ps(_mm512_loadu_ps(second + i), a));
+
+        _mm512_storeu_ps(child + i, _mm512_add_ps(a, product));
+      }
+
+      blendScalar(first + vectorSize, second + vectorSize, alpha, size - vectorSize, child + vectorSize);
+    }
+
+    TARGET_AVX512 void laneGemvAvx512(const float* weights, size_t rows, size_t cols, const float* inputs, const float* bias, float* outputs) {
+      for (size_t i = 0; i < rows; i++) {
+        const float* row = weights + i * cols * LANES;
+        __m512 total = _mm512_loadu_ps(bias + i * LANES);
+
+        for (size_t j = 0; j < cols; j++) {
+          total = _mm512_add_ps(total, _mm512_mul_ps(_mm512_loadu_ps(row + j * LANES), _mm512_loadu_ps(inputs + j * LANES)));
+        }
+
+        _mm512_storeu_ps(outputs + i * LANES, total);
+      }
+    }
+
+  } // namespace kernel
+
+} // namespace neuro
+
+#endif
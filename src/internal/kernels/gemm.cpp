@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <cstddef>
+
+#include "internal/kernels.hpp"
+
+namespace neuro {
+
+  namespace kernel {
+
+    namespace {
+
+      constexpr size_t L1_BLOCK_FLOATS = 8 * 1024;
+      constexpr size_t L2_BLOCK_FLOATS = 32 * 1024;
+
+    } // namespace
+
+    // Weight rows are blocked to stay resident in L2 while every sample block streams past them, and
+    // sample blocks are sized for L1 so each input row is reused across the whole weight block.
+    void gemmBlocked(gemm_tile_fn tile,
+                     gemv_fn gemv,
+                     const float* weights,
+                     size_t stride,
+                     size_t rows,
+                     size_t cols,
+                     const float* inputs,
+                     size_t batch,
+                     const float* bias,
+                     float* outputs) {
+      const size_t width = std::max<size_t>(cols, 1);
+      const size_t rowBlock = std::max(GEMM_TILE_ROWS, L2_BLOCK_FLOATS / width / GEMM_TILE_ROWS * GEMM_TILE_ROWS);
+      const size_t sampleBlock = std::max(GEMM_TILE_SAMPLES, L1_BLOCK_FLOATS / width / GEMM_TILE_SAMPLES * GEMM_TILE_SAMPLES);
+
+      for (size_t rowStart = 0; rowStart < rows; rowStart += rowBlock) {
+        const size_t rowEnd = std::min(rows, rowStart + rowBlock);
+        const size_t tiledRowEnd = rowStart + (rowEnd - rowStart) / GEMM_TILE_ROWS * GEMM_TILE_ROWS;
+
+        for (size_t sampleStart = 0; sampleStart < batch; sampleStart += sampleBlock) {
+          const size_t sampleEnd = std::min(batch, sampleStart + sampleBlock);
+
+          size_t s = sampleStart;
+
+          for (; s + GEMM_TILE_SAMPLES <= sampleEnd; s += GEMM_TILE_SAMPLES) {
+            const float* input = inputs + s * cols;
+            float* output = outputs + s * rows;
+
+            for (size_t r = rowStart; r < tiledRowEnd; r += GEMM_TILE_ROWS) {
+              tile(input, cols, weights + r * stride, stride, cols, bias + r, output + r, rows);
+            }
+
+            for (size_t i = 0; i < GEMM_TILE_SAMPLES && tiledRowEnd < rowEnd; i++) {
+              gemv(weights + tiledRowEnd * stride, stride, rowEnd - tiledRowEnd, cols, input + i * cols, bias + tiledRowEnd, output + i * rows + tiledRowEnd);
+            }
+          }
+
+          for (; s < sampleEnd; s++) {
+            gemv(weights + rowStart * stride, stride, rowEnd - rowStart, cols, inputs + s * cols, bias + rowStart, outputs + s * rows + rowStart);
+          }
+        }
+      }
+    }
+
+  } // namespace kernel
+
+} // namespace neuro
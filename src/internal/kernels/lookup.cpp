@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include "internal/attribute.hpp"
+#include "internal/kernels.hpp"
+
+namespace neuro {
+
+  namespace kernel {
+
+    namespace {
+
+      constexpr size_t LOOKUP_INTERVALS = 2048;
+
+      struct LookupTable {
+        float minimum;
+        float maximum;
+        float scale;
+        std::array<float, LOOKUP_INTERVALS + 1> samples;
+
+        template <typename Function>
+        LookupTable(float minimum, float maximum, Function function)
+            : minimum(minimum), maximum(maximum), scale(static_cast<float>(LOOKUP_INTERVALS) / (maximum - minimum)) {
+          const double step = (static_cast<double>(maximum) - minimum) / LOOKUP_INTERVALS;
+
+          for (size_t i = 0; i <= LOOKUP_INTERVALS; i++) {
+            samples[i] = static_cast<float>(function(minimum + step * static_cast<double>(i)));
+          }
+        }
+
+        // Inputs outside [minimum, maximum] are clamped to the boundary samples.
+        FORCE_INLINE float operator()(float x) const {
+          const float position = (std::min(std::max(x, minimum), maximum) - minimum) * scale;
+          const size_t index = std::min(static_cast<size_t>(position), LOOKUP_INTERVALS - 1);
+          const float fraction = position - static_cast<float>(index);
+
+          return samples[index] + fraction * (samples[index + 1] - samples[index]);
+        }
+      };
+
+      const LookupTable& sigmoidTable() {
+        static const LookupTable table(-16.0f, 16.0f, [](double x) { return 1.0 / (1.0 + std::exp(-x)); });
+        return table;
+      }
+
+      const LookupTable& tanhTable() {
+        static const LookupTable table(-8.0f, 8.0f, [](double x) { return std::tanh(x); });
+        return table;
+      }
+
+      const LookupTable& eluTable() {
+        static const LookupTable table(-16.0f, 0.0f, [](double x) { return std::expm1(x); });
+        return table;
+      }
+
+      const LookupTable& softplusTable() {
+        static const LookupTable table(-16.0f, 16.0f, [](double x) { return std::log1p(std::exp(x)); });
+        return table;
+      }
+
+    } // namespace
+
+    void activateTable(ActivationKind kind, float* values, size_t size) {
+      switch (kind) {
+      case ActivationKind::Sigmoid: {
+        const auto& table = sigmoidTable();
+
+        for (size_t i = 0; i < size; i++) {
+          values[i] = table(values[i]);
+        }
+        break;
+      }
+
+      case ActivationKind::Tanh: {
+        const auto& table = tanhTable();
+
+        for (size_t i = 0; i < size; i++) {
+          values[i] = table(values[i]);
+        }
+        break;
+      }
+
+      case ActivationKind::Elu: {
+        const auto& table = eluTable();
+
+        for (size_t i = 0; i < size; i++) {
+          values[i] = values[i] >= 0 ? values[i] : table(values[i]);
+        }
+        break;
+      }
+
+      case ActivationKind::Swish: {
+        const auto& table = sigmoidTable();
+
+        for (size_t i = 0; i < size; i++) {
+          values[i] *= table(values[i]);
+        }
+        break;
+      }
+
+      case ActivationKind::Softplus: {
+        const auto& table = softplusTable();
+
+        for (size_t i = 0; i < size; i++) {
+          values[i] = values[i] > table.maximum ? values[i] : table(values[i]);
+        }
+        break;
+      }
+
+      default: activeKernels().activate(kind, values, size); break;
+      }
+    }
+
+  } // namespace kernel
+
+} // namespace neuro
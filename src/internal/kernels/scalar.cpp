@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "internal/attribute.hpp"
+#include "internal/fast_math.hpp"
+#include "internal/kernels.hpp"
+#include "neuro/utils/random.hpp"
+
+namespace neuro {
+
+  namespace kernel {
+
+    void gemvScalar(const float* weights, size_t stride, size_t rows, size_t cols, const float* input, const float* bias, float* output) {
+      for (size_t i = 0; i < rows; i++) {
+        const float* row = weights + i * stride;
+        float total = bias[i];
+
+        for (size_t j = 0; j < cols; j++) {
+          total += row[j] * input[j];
+        }
+
+        output[i] = total;
+      }
+    }
+
+    namespace {
+
+      void gemmTileScalar(const float* inputs, size_t inputStride, const float* weights, size_t stride, size_t cols, const float* bias, float* outputs, size_t outputStride) {
+        for (size_t s = 0; s < GEMM_TILE_SAMPLES; s++) {
+          const float* input = inputs + s * inputStride;
+
+          for (size_t r = 0; r < GEMM_TILE_ROWS; r++) {
+            const float* row = weights + r * stride;
+            float total = bias[r];
+
+            for (size_t j = 0; j < cols; j++) {
+              total += row[j] * input[j];
+            }
+
+            outputs[s * outputStride + r] = total;
+          }
+        }
+      }
+
+    } // namespace
+
+    void gemmScalar(const float* weights, size_t stride, size_t rows, size_t cols, const float* inputs, size_t batch, const float* bias, float* outputs) {
+      gemmBlocked(gemmTileScalar, gemvScalar, weights, stride, rows, cols, inputs, batch, bias, outputs);
+    }
+
+    namespace {
+
+      template <typename Operation>
+      FORCE_INLINE void transform(float* values, size_t size, Operation operation) {
+        for (size_t i = 0; i < size; i++) {
+          values[i] = operation(values[i]);
+        }
+      }
+
+    } // namespace
+
+    void activateScalar(ActivationKind kind, float* values, size_t size) {
+      switch (kind) {
+      case ActivationKind::Identity:
+      case ActivationKind::Custom: break;
+      case ActivationKind::Sigmoid: transform(values, size, [](float x) { return 1.0f / (1.0f + std::exp(-x)); }); break;
+      case ActivationKind::Relu: transform(values, size, [](float x) { return x > 0 ? x : 0.0f; }); break;
+      case ActivationKind::Tanh: transform(values, size, [](float x) { return std::tanh(x); }); break;
+      case ActivationKind::LeakyRelu: transform(values, size, [](float x) { return x > 0 ? x : 0.01f * x; }); break;
+      case ActivationKind::Elu: transform(values, size, [](float x) { return x >= 0 ? x : std::exp(x) - 1.0f; }); break;
+      case ActivationKind::Swish: transform(values, size, [](float x) { return x / (1.0f + std::exp(-x)); }); break;
+      case ActivationKind::Softplus: transform(values, size, [](float x) { return std::log1p(std::exp(x)); }); break;
+      case ActivationKind::HardSigmoid: transform(values, size, [](float x) { return std::max(0.0f, std::min(1.0f, 0.2f * x + 0.5f)); }); break;
+      }
+    }
+
+    void activateFastScalar(ActivationKind kind, float* values, size_t size) {
+      switch (kind) {
+      case ActivationKind::Sigmoid: transform(values, size, [](float x) { return fast_math::sigmoid(x); }); break;
+      case ActivationKind::Tanh: transform(values, size, [](float x) { return fast_math::tanh(x); }); break;
+      case ActivationKind::Elu: transform(values, size, [](float x) { return fast_math::elu(x); }); break;
+      case ActivationKind::Swish: transform(values, size, [](float x) { return fast_math::swish(x); }); break;
+      case ActivationKind::Softplus: transform(values, size, [](float x) { return fast_math::softplus(x); }); break;
+      default: activateScalar(kind, values, size); break;
+      }
+    }
+
+    void philoxScalar(const uint32_t* counter, const uint32_t* key, size_t blocks, uint32_t* output) {
+      for (size_t b = 0; b < blocks; b++) {
+        const auto block = RandomStream::philox({counter[0] + static_cast<uint32_t>(b), counter[1], counter[2], counter[3]}, {key[0], key[1]});
+
+        std::copy(block.begin(), block.end(), output + b * 4);
+      }
+    }
+
+    void selectScalar(const float* first, const float* second, const uint32_t* mask, size_t size, float* child) {
+      for (size_t i = 0; i < size; i++) {
+        child[i] = (mask[i / 32] >> (i % 32)) & 1u ? second[i] : first[i];
+      }
+    }
+
+    void blendScalar(const float* first, const float* second, float alpha, size_t size, float* child) {
+      for (size_t i = 0; i < size; i++) {
+        child[i] = first[i] + alpha * (second[i] - first[i]);
+      }
+    }
+
+    void laneGemvScalar(const float* weights, size_t rows, size_t cols, const float* inputs, const float* bias, float* outputs) {
+      for (size_t i = 0; i < rows; i++) {
+        const float* row = weights + i * cols * LANES;
+        float totals[LANES];
+
+        std::copy_n(bias + i * LANES, LANES, totals);
+
+        for (size_t j = 0; j < cols; j++) {
+          for (size_t k = 0; k < LANES; k++) {
+            totals[k] += row[j * LANES + k] * inputs[j * LANES + k];
+          }
+        }
+
+        std::copy_n(totals, LANES, outputs + i * LANES);
+      }
+    }
+
+  } // namespace kernel
+
+} // namespace neuro
@@ -0,0 +1,352 @@
+#include "internal/attribute.hpp"
+#include "internal/fast_math.hpp"
+#include "internal/kernels.hpp"
+
+#ifdef NEURO_ARCH_X86
+
+#include <emmintrin.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace neuro {
+
+  namespace kernel {
+
+    namespace {
+
+      TARGET_SSE2 FORCE_INLINE float horizontalSum(__m128 value) {
+        __m128 shuffled = _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1));
+        __m128 sums = _mm_add_ps(value, shuffled);
+
+        shuffled = _mm_movehl_ps(shuffled, sums);
+        sums = _mm_add_ss(sums, shuffled);
+
+        return _mm_cvtss_f32(sums);
+      }
+
+    } // namespace
+
+    TARGET_SSE2 void gemvSse2(const float* weights, size_t stride, size_t rows, size_t cols, const float* input, const float* bias, float* output) {
+      const size_t vectorCols = cols & ~size_t(3);
+
+      size_t i = 0;
+
+      for (; i + 4 <= rows; i += 4) {
+        const float* row0 = weights + i * stride;
+        const float* row1 = row0 + stride;
+        const float* row2 = row1 + stride;
+        const float* row3 = row2 + stride;
+
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps();
+        __m128 acc3 = _mm_setzero_ps();
+
+        for (size_t j = 0; j < vectorCols; j += 4) {
+          __m128 x = _mm_loadu_ps(input + j);
+
+          acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(row0 + j), x));
+          acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(row1 + j), x));
+          acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(row2 + j), x));
+          acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(row3 + j), x));
+        }
+
+        float total0 = bias[i] + horizontalSum(acc0);
+        float total1 = bias[i + 1] + horizontalSum(acc1);
+        float total2 = bias[i + 2] + horizontalSum(acc2);
+        float total3 = bias[i + 3] + horizontalSum(acc3);
+
+        for (size_t j = vectorCols; j < cols; j++) {
+          total0 += row0[j] * input[j];
+          total1 += row1[j] * input[j];
+          total2 += row2[j] * input[j];
+          total3 += row3[j] * input[j];
+        }
+
+        output[i] = total0;
+        output[i + 1] = total1;
+        output[i + 2] = total2;
+        output[i + 3] = total3;
+      }
+
+      for (; i < rows; i++) {
+        const float* row = weights + i * stride;
+        __m128 acc = _mm_setzero_ps();
+
+        for (size_t j = 0; j < vectorCols; j += 4) {
+          acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(row + j), _mm_loadu_ps(input + j)));
+        }
+
+        float total = bias[i] + horizontalSum(acc);
+
+        for (size_t j = vectorCols; j < cols; j++) {
+          total += row[j] * input[j];
+        }
+
+        output[i] = total;
+      }
+    }
+
+    namespace {
+
+      TARGET_SSE2 void gemmTileSse2(const float* inputs, size_t inputStride, const float* weights, size_t stride, size_t cols, const float* bias, float* outputs, size_t outputStride) {
+        const size_t vectorCols = cols & ~size_t(3);
+
+        const float* input0 = inputs;
+        const float* input1 = input0 + inputStride;
+        const float* input2 = input1 + inputStride;
+        const float* input3 = input2 + inputStride;
+
+        const float* row0 = weights;
+        const float* row1 = weights + stride;
+
+        __m128 acc00 = _mm_setzero_ps(), acc01 = _mm_setzero_ps();
+        __m128 acc10 = _mm_setzero_ps(), acc11 = _mm_setzero_ps();
+        __m128 acc20 = _mm_setzero_ps(), acc21 = _mm_setzero_ps();
+        __m128 acc30 = _mm_setzero_ps(), acc31 = _mm_setzero_ps();
+
+        for (size_t j = 0; j < vectorCols; j += 4) {
+          __m128 w0 = _mm_loadu_ps(row0 + j);
+          __m128 w1 = _mm_loadu_ps(row1 + j);
+
+          __m128 x = _mm_loadu_ps(input0 + j);
+          acc00 = _mm_add_ps(acc00, _mm_mul_ps(w0, x));
+          acc01 = _mm_add_ps(acc01, _mm_mul_ps(w1, x));
+
+          x = _mm_loadu_ps(input1 + j);
+          acc10 = _mm_add_ps(acc10, _mm_mul_ps(w0, x));
+          acc11 = _mm_add_ps(acc11, _mm_mul_ps(w1, x));
+
+          x = _mm_loadu_ps(input2 + j);
+          acc20 = _mm_add_ps(acc20, _mm_mul_ps(w0, x));
+          acc21 = _mm_add_ps(acc21, _mm_mul_ps(w1, x));
+
+          x = _mm_loadu_ps(input3 + j);
+          acc30 = _mm_add_ps(acc30, _mm_mul_ps(w0, x));
+          acc31 = _mm_add_ps(acc31, _mm_mul_ps(w1, x));
+        }
+
+        float totals[8] = {
+          bias[0] + horizontalSum(acc00), bias[1] + horizontalSum(acc01),
+          bias[0] + horizontalSum(acc10), bias[1] + horizontalSum(acc11),
+          bias[0] + horizontalSum(acc20), bias[1] + horizontalSum(acc21),
+          bias[0] + horizontalSum(acc30), bias[1] + horizontalSum(acc31),
+        };
+
+        const float* sampleInputs[4] = {input0, input1, input2, input3};
+
+        for (size_t s = 0; s < 4; s++) {
+          for (size_t j = vectorCols; j < cols; j++) {
+            totals[s * 2] += row0[j] * sampleInputs[s][j];
+            totals[s * 2 + 1] += row1[j] * sampleInputs[s][j];
+          }
+
+          outputs[s * outputStride] = totals[s * 2];
+          outputs[s * outputStride + 1] = totals[s * 2 + 1];
+        }
+      }
+
+    } // namespace
+
+    TARGET_SSE2 void gemmSse2(const float* weights, size_t stride, size_t rows, size_t cols, const float* inputs, size_t batch, const float* bias, float* outputs) {
+      gemmBlocked(gemmTileSse2, gemvSse2, weights, stride, rows, cols, inputs, batch, bias, outputs);
+    }
+
+    TARGET_SSE2 void activateSse2(ActivationKind kind, float* values, size_t size) {
+      const size_t vectorSize = size & ~size_t(3);
+      const __m128 zero = _mm_setzero_ps();
+
+      switch (kind) {
+      case ActivationKind::Relu:
+        for (size_t i = 0; i < vectorSize; i += 4) {
+          _mm_storeu_ps(values + i, _mm_max_ps(_mm_loadu_ps(values + i), zero));
+        }
+        break;
+
+      case ActivationKind::LeakyRelu: {
+        const __m128 slope = _mm_set1_ps(0.01f);
+
+        for (size_t i = 0; i < vectorSize; i += 4) {
+          __m128 x = _mm_loadu_ps(values + i);
+          __m128 positive = _mm_cmpgt_ps(x, zero);
+
+          _mm_storeu_ps(values + i, _mm_or_ps(_mm_and_ps(positive, x), _mm_andnot_ps(positive, _mm_mul_ps(x, slope))));
+        }
+        break;
+      }
+
+      case ActivationKind::HardSigmoid: {
+        const __m128 slope = _mm_set1_ps(0.2f);
+        const __m128 offset = _mm_set1_ps(0.5f);
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        for (size_t i = 0; i < vectorSize; i += 4) {
+          __m128 x = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(values + i), slope), offset);
+
+          _mm_storeu_ps(values + i, _mm_max_ps(_mm_min_ps(x, one), zero));
+        }
+        break;
+      }
+
+      default:
+        activateScalar(kind, values, size);
+        return;
+      }
+
+      activateScalar(kind, values + vectorSize, size - vectorSize);
+    }
+
+    namespace {
+
+      TARGET_SSE2 FORCE_INLINE __m128 select(__m128 mask, __m128 whenTrue, __m128 whenFalse) {
+        return _mm_or_ps(_mm_and_ps(mask, whenTrue), _mm_andnot_ps(mask, whenFalse));
+      }
+
+      TARGET_SSE2 FORCE_INLINE __m128 fastExp(__m128 x) {
+        x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(fast_math::EXP_MIN)), _mm_set1_ps(fast_math::EXP_MAX));
+
+        const __m128i exponent = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(fast_math::LOG2E)));
+        const __m128 n = _mm_cvtepi32_ps(exponent);
+        __m128 r = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(fast_math::LN2_HI)));
+        r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(fast_math::LN2_LO)));
+
+        __m128 p = _mm_set1_ps(fast_math::EXP_P0);
+        p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(fast_math::EXP_P1));
+        p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(fast_math::EXP_P2));
+        p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(fast_math::EXP_P3));
+        p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(fast_math::EXP_P4));
+        p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(fast_math::EXP_P5));
+
+        const __m128 y = _mm_add_ps(_mm_mul_ps(p, _mm_mul_ps(r, r)), _mm_add_ps(r, _mm_set1_ps(1.0f)));
+        const __m128i bits = _mm_slli_epi32(_mm_add_epi32(exponent, _mm_set1_epi32(127)), 23);
+
+        return _mm_mul_ps(y, _mm_castsi128_ps(bits));
+      }
+
+      TARGET_SSE2 FORCE_INLINE __m128 fastLog1pUnit(__m128 t) {
+        const __m128 halve = _mm_cmpgt_ps(t, _mm_set1_ps(fast_math::SQRT2_MINUS_ONE));
+        const __m128 numerator = select(halve, _mm_sub_ps(t, _mm_set1_ps(1.0f)), t);
+        const __m128 denominator = _mm_add_ps(t, select(halve, _mm_set1_ps(3.0f), _mm_set1_ps(2.0f)));
+        const __m128 s = _mm_div_ps(numerator, denominator);
+        const __m128 s2 = _mm_mul_ps(s, s);
+
+        __m128 p = _mm_set1_ps(1.0f / 9.0f);
+        p = _mm_add_ps(_mm_mul_ps(p, s2), _mm_set1_ps(1.0f / 7.0f));
+        p = _mm_add_ps(_mm_mul_ps(p, s2), _mm_set1_ps(1.0f / 5.0f));
+        p = _mm_add_ps(_mm_mul_ps(p, s2), _mm_set1_ps(1.0f / 3.0f));
+        p = _mm_add_ps(_mm_mul_ps(p, s2), _mm_set1_ps(1.0f));
+
+        return _mm_add_ps(_mm_mul_ps(_mm_add_ps(s, s), p), _mm_and_ps(halve, _mm_set1_ps(fast_math::LN2)));
+      }
+
+      TARGET_SSE2 FORCE_INLINE __m128 fastSigmoid(__m128 x) {
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        return _mm_div_ps(one, _mm_add_ps(one, fastExp(_mm_sub_ps(_mm_setzero_ps(), x))));
+      }
+
+      TARGET_SSE2 FORCE_INLINE __m128 fastTanh(__m128 x) {
+        const __m128 sign = _mm_set1_ps(-0.0f);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 magnitude = _mm_andnot_ps(sign, x);
+        const __m128 t = _mm_sub_ps(one, _mm_div_ps(_mm_set1_ps(2.0f), _mm_add_ps(one, fastExp(_mm_add_ps(magnitude, magnitude)))));
+
+        return _mm_or_ps(t, _mm_and_ps(sign, x));
+      }
+
+      TARGET_SSE2 FORCE_INLINE __m128 fastElu(__m128 x) {
+        const __m128 negative = _mm_sub_ps(fastExp(x), _mm_set1_ps(1.0f));
+
+        return select(_mm_cmpge_ps(x, _mm_setzero_ps()), x, negative);
+      }
+
+      TARGET_SSE2 FORCE_INLINE __m128 fastSwish(__m128 x) {
+        return _mm_div_ps(x, _mm_add_ps(_mm_set1_ps(1.0f), fastExp(_mm_sub_ps(_mm_setzero_ps(), x))));
+      }
+
+      TARGET_SSE2 FORCE_INLINE __m128 fastSoftplus(__m128 x) {
+        const __m128 magnitude = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+
+        return _mm_add_ps(_mm_max_ps(x, _mm_setzero_ps()), fastLog1pUnit(fastExp(_mm_sub_ps(_mm_setzero_ps(), magnitude))));
+      }
+
+      template <__m128 (*Operation)(__m128)>
+      TARGET_SSE2 void transformFast(ActivationKind kind, float* values, size_t size) {
+        const size_t vectorSize = size & ~size_t(3);
+
+        for (size_t i = 0; i < vectorSize; i += 4) {
+          _mm_storeu_ps(values + i, Operation(_mm_loadu_ps(values + i)));
+        }
+
+        activateFastScalar(kind, values + vectorSize, size - vectorSize);
+      }
+
+    } // namespace
+
+    TARGET_SSE2 void activateFastSse2(ActivationKind kind, float* values, size_t size) {
+      switch (kind) {
+      case ActivationKind::Sigmoid: transformFast<fastSigmoid>(kind, values, size); break;
+      case ActivationKind::Tanh: transformFast<fastTanh>(kind, values, size); break;
+      case ActivationKind::Elu: transformFast<fastElu>(kind, values, size); break;
+      case ActivationKind::Swish: transformFast<fastSwish>(kind, values, size); break;
+      case ActivationKind::Softplus: transformFast<fastSoftplus>(kind, values, size); break;
+      default: activateSse2(kind, values, size); break;
+      }
+    }
+
+    TARGET_SSE2 void selectSse2(const float* first, const float* second, const uint32_t* mask, size_t size, float* child) {
+      const size_t vectorSize = size & ~size_t(3);
+      const __m128i lanes = _mm_setr_epi32(1, 2, 4, 8);
+
+      for (size_t i = 0; i < vectorSize; i += 4) {
+        const __m128i bits = _mm_set1_epi32(static_cast<int>((mask[i / 32] >> (i % 32)) & 0xFu));
+        const __m128 selected = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(bits, lanes), lanes));
+
+        _mm_storeu_ps(child + i, _mm_or_ps(_mm_and_ps(selected, _mm_loadu_ps(second + i)), _mm_andnot_ps(selected, _mm_loadu_ps(first + i))));
+      }
+
+      for (size_t i = vectorSize; i < size; i++) {
+        child[i] = (mask[i / 32] >> (i % 32)) & 1u ? second[i] : first[i];
+      }
+    }
+
+    TARGET_SSE2 void blendSse2(const float* first, const float* second, float alpha, size_t size, float* child) {
+      const size_t vectorSize = size & ~size_t(3);
+      const __m128 factor = _mm_set1_ps(alpha);
+
+      for (size_t i = 0; i < vectorSize; i += 4) {
+        const __m128 a = _mm_loadu_ps(first + i);
+
+        _mm_storeu_ps(child + i, _mm_add_ps(a, _mm_mul_ps(factor, _mm_sub_ps(_mm_loadu_ps(second + i), a))));
+      }
+
+      blendScalar(first + vectorSize, second + vectorSize, alpha, size - vectorSize, child + vectorSize);
+    }
+
+    TARGET_SSE2 void laneGemvSse2(const float* weights, size_t rows, size_t cols, const float* inputs, const float* bias, float* outputs) {
+      for (size_t i = 0; i < rows; i++) {
+        const float* row = weights + i * cols * LANES;
+        __m128 totals[4];
+
+        for (size_t q = 0; q < 4; q++) {
+          totals[q] = _mm_loadu_ps(bias + i * LANES + q * 4);
+        }
+
+        for (size_t j = 0; j < cols; j++) {
+          for (size_t q = 0; q < 4; q++) {
+            totals[q] = _mm_add_ps(totals[q], _mm_mul_ps(_mm_loadu_ps(row + j * LANES + q * 4), _mm_loadu_ps(inputs + j * LANES + q * 4)));
+          }
+        }
+
+        for (size_t q = 0; q < 4; q++) {
+          _mm_storeu_ps(outputs + i * LANES + q * 4, totals[q]);
+        }
+      }
+    }
+
+  } // namespace kernel
+
+} // namespace neuro
+
+#endif
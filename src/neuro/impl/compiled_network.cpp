@@ -0,0 +1,155 @@
+#include "neuro/impl/compiled_network.hpp"
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+
+#include "internal/kernels.hpp"
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+#include "neuro/impl/dense_layer.hpp"
+#include "neuro/impl/neural_network.hpp"
+#include "neuro/types.hpp"
+
+namespace neuro {
+
+  namespace {
+
+    size_t vectorWidth(SimdLevel level) {
+      switch (level) {
+      case SimdLevel::AVX512: return 16;
+      case SimdLevel::AVX2: return 8;
+      case SimdLevel::SSE2: return 4;
+      case SimdLevel::Scalar: break;
+      }
+
+      return 1;
+    }
+
+    kernel::activate_fn resolveActivation(const kernel::KernelTable& kernels, const ActivationFunction& activation) {
+      if (activation.getKind() == ActivationKind::Custom) {
+        return nullptr;
+      }
+
+      switch (activation.getPrecision()) {
+      case ActivationPrecision::Fast: return kernels.activateFast;
+      case ActivationPrecision::Table: return kernel::activateTable;
+      case ActivationPrecision::Exact: break;
+      }
+
+      return kernels.activate;
+    }
+
+  } // namespace
+
+  CompiledNetwork::CompiledNetwork(const NeuralNetwork& network)
+    : kernels(&kernel::activeKernels()) {
+    static_assert(std::is_same_v<decltype(Step::activate), kernel::activate_fn>, "Step::activate must match kernel::activate_fn");
+
+    if (network.empty()) {
+      throw exception::InvalidNetworkArchitectureException("Cannot compile a network without layers");
+    }
+
+    inputWidth = network.inputSize();
+    maxWidth = network.maxLayerWidth();
+
+    size_t previousOutput = inputWidth;
+    size_t totalSize = 0;
+
+    for (size_t i = 0; i < network.sizeLayers(); i++) {
+      const auto* dense = dynamic_cast<const DenseLayer*>(&network[i]);
+
+      if (dense == nullptr) {
+        throw exception::InvalidNetworkArchitectureException("Only dense layers can be compiled (layer " + std::to_string(i) + ")");
+      }
+
+      if (dense->inputSize() != previousOutput || dense->outputSize() == 0 || dense->getBiases().size() != dense->outputSize()) {
+        throw exception::InvalidNetworkArchitectureException("Layer " + std::to_string(i) + " does not match the output of the previous layer");
+      }
+
+      const auto& activation = dense->getActivationFunction();
+
+      Step step{dense->outputSize(), dense->inputSize(), packedStride(dense->inputSize(), kernels->level), 0, 0, resolveActivation(*kernels, activation),
+                activation.getKind(), activation};
+
+      step.weightOffset = totalSize;
+      step.biasOffset = step.weightOffset + step.rows * step.stride;
+      totalSize = step.biasOffset + packedStride(step.rows, kernels->level);
+
+      steps.push_back(step);
+      previousOutput = step.rows;
+    }
+
+    parameters.assign(totalSize, 0.0f);
+
+    for (size_t i = 0; i < steps.size(); i++) {
+      const auto& step = steps[i];
+      const auto& weights = network[i].getWeights();
+      const auto& biases = network[i].getBiases();
+
+      for (size_t row = 0; row < step.rows; row++) {
+        std::copy(weights.row(row).begin(), weights.row(row).end(), parameters.data() + step.weightOffset + row * step.stride);
+      }
+
+      std::copy(biases.begin(), biases.end(), parameters.data() + step.biasOffset);
+    }
+
+    buffers.reserve(maxWidth);
+  }
+
+  neuro_layer_t CompiledNetwork::feedforward(const neuro_layer_t& inputs) {
+    neuro_layer_t outputs(outputSize());
+    feedforward(inputs, outputs);
+
+    return outputs;
+  }
+
+  void CompiledNetwork::feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs) {
+    feedforward(inputs, outputs, buffers);
+  }
+
+  void CompiledNetwork::feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs, InferenceWorkspace& workspace) const {
+    if (inputs.size() != inputWidth) {
+      throw exception::InvalidNetworkArchitectureException("Amount of data input does not match neuron data input");
+    }
+
+    if (outputs.size() != outputSize()) {
+      throw exception::InvalidNetworkArchitectureException("Output buffer size does not match network output size");
+    }
+
+    workspace.reserve(maxWidth);
+
+    run(inputs.data(), outputs.data(), workspace);
+  }
+
+  SimdLevel CompiledNetwork::level() const {
+    return kernels->level;
+  }
+
+  size_t CompiledNetwork::packedStride(size_t cols, SimdLevel level) {
+    const size_t width = vectorWidth(level);
+
+    return (cols + width - 1) / width * width;
+  }
+
+  void CompiledNetwork::run(const float* inputs, float* outputs, InferenceWorkspace& workspace) const {
+    const float* source = inputs;
+    const float* data = parameters.data();
+
+    for (size_t i = 0; i < steps.size(); i++) {
+      const auto& step = steps[i];
+      float* target = i + 1 == steps.size() ? outputs : workspace.backData();
+
+      kernels->gemv(data + step.weightOffset, step.stride, step.rows, step.cols, source, data + step.biasOffset, target);
+
+      if (step.activate != nullptr) {
+        step.activate(step.kind, target, step.rows);
+      } else {
+        step.custom.apply(target, step.rows);
+      }
+
+      workspace.swap();
+      source = workspace.frontData();
+    }
+  }
+
+} // namespace neuro
@@ -1,15 +1,17 @@
 #include "neuro/impl/dense_layer.hpp"
 
 #include <memory>
-#include <random>
 #include <vector>
 
-#include "internal/random_engine.hpp"
+#include "internal/kernels.hpp"
 #include "neuro/capabilities/i_layer_weight.hpp"
 #include "neuro/exceptions/invalid_network_architecture_exception.hpp"
 #include "neuro/interfaces/i_layer.hpp"
 #include "neuro/types.hpp"
 #include "neuro/utils/activation.hpp"
+#include "neuro/utils/mutation.hpp"
+#include "neuro/utils/random.hpp"
+#include "neuro/utils/thread_pool.hpp"
 
 namespace neuro {
 
@@ -20,7 +22,7 @@ namespace neuro {
 
   DenseLayer::DenseLayer(const layer_bias_t& biases)
     : ILayer(),
-      weights(biases.size()),
+      weights(biases.size(), 0),
       biases(biases) {}
 
   DenseLayer::DenseLayer(const ActivationFunction& activation)
@@ -29,12 +31,12 @@ namespace neuro {
 
   DenseLayer::DenseLayer(size_t inputSize, size_t outputSize)
     : ILayer(),
-      weights(outputSize, neuro_layer_t(inputSize)),
+      weights(outputSize, inputSize),
       biases(outputSize) {}
 
   DenseLayer::DenseLayer(size_t inputSize, size_t outputSize, const ActivationFunction& activation)
     : ILayer(),
-      weights(outputSize, neuro_layer_t(inputSize)),
+      weights(outputSize, inputSize),
       biases(outputSize),
       activation(activation) {}
 
@@ -46,7 +48,7 @@ namespace neuro {
 
   DenseLayer::DenseLayer(const layer_bias_t& biases, const ActivationFunction& activation)
     : ILayer(),
-      weights(biases.size()),
+      weights(biases.size(), 0),
       biases(biases),
       activation(activation) {}
 
@@ -64,100 +66,149 @@ namespace neuro {
   neuro_layer_t DenseLayer::feedforward(const neuro_layer_t& inputs) const {
     neuro_layer_t outputs(biases.size());
 
-    for (size_t i = 0; i < outputs.size(); i++) {
-      float total = biases[i];
+    computeRows(inputs.data(), inputs.size(), outputs.data());
 
-      for (size_t j = 0; j < inputs.size(); j++) {
-        total += weights[i][j] * inputs[j];
-      }
+    return outputs;
+  }
 
-      outputs[i] = activation.activate(total);
+  void DenseLayer::feedforward(const float* inputs, float* outputs) const {
+    computeRows(inputs, weights.cols(), outputs);
+  }
+
+  neuro_layer_t DenseLayer::feedforwardBatch(const neuro_layer_t& inputs, size_t batchSize) const {
+    if (inputs.size() != batchSize * inputSize()) {
+      throw exception::InvalidNetworkArchitectureException("Batch input size does not match batch size times layer input size");
     }
 
+    neuro_layer_t outputs(batchSize * outputSize());
+
+    feedforwardBatch(inputs.data(), batchSize, outputs.data());
+
     return outputs;
   }
 
+  void DenseLayer::feedforwardBatch(const float* inputs, size_t batchSize, float* outputs) const {
+    kernel::activeKernels().gemm(weights.data(), weights.stride(), weights.rows(), weights.cols(), inputs, batchSize, biases.data(), outputs);
+
+    activation.apply(outputs, batchSize * weights.rows());
+  }
+
+  void DenseLayer::computeRows(const float* inputs, size_t cols, float* outputs) const {
+    const auto gemv = kernel::activeKernels().gemv;
+    const size_t rows = biases.size();
+
+    if (parallelThreshold == 0 || rows * cols < parallelThreshold) {
+      gemv(weights.data(), weights.stride(), rows, cols, inputs, biases.data(), outputs);
+      activation.apply(outputs, rows);
+      return;
+    }
+
+    // Chunks of 16 rows keep each worker's outputs on separate cache lines.
+    ThreadPool::global().parallelFor(rows, 16, [&](size_t begin, size_t end) {
+      gemv(weights.row(begin).data(), weights.stride(), end - begin, cols, inputs, biases.data() + begin, outputs + begin);
+      activation.apply(outputs + begin, end - begin);
+    });
+  }
+
   void DenseLayer::reshape(size_t newInputSize, size_t newOutputSize) {
-    weights = layer_weight_t(newOutputSize, neuro_layer_t(newInputSize));
+    weights.reshape(newOutputSize, newInputSize);
     biases = layer_bias_t(newOutputSize);
+    touch();
   }
 
   void DenseLayer::randomizeWeights(float min, float max) {
-    std::uniform_real_distribution<float> dist(min, max);
-
-    for (size_t i = 0; i < weights.size(); i++) {
-      for (size_t j = 0; j < weights[i].size(); j++) {
-        weights[i][j] = dist(random_engine);
-      }
-    }
+    randomizeWeights(min, max, RandomStream::local());
   }
 
   void DenseLayer::randomizeBiases(float min, float max) {
-    std::uniform_real_distribution<float> dist(min, max);
+    randomizeBiases(min, max, RandomStream::local());
+  }
 
-    for (size_t i = 0; i < biases.size(); i++) {
-      biases[i] = dist(random_engine);
+  void DenseLayer::randomizeWeights(float min, float max, RandomStream& random) {
+    for (size_t i = 0; i < weights.rows(); i++) {
+      random.fillUniform(weights.data() + i * weights.stride(), weights.cols(), min, max);
     }
+
+    touch();
+  }
+
+  void DenseLayer::randomizeBiases(float min, float max, RandomStream& random) {
+    random.fillUniform(biases.data(), biases.size(), min, max);
+    touch();
   }
 
   void DenseLayer::mutateWeights(const std::function<float(float)>& mutator) {
-    for (size_t i = 0; i < weights.size(); i++) {
-      for (size_t j = 0; j < weights[i].size(); j++) {
-        weights[i][j] += mutator(weights[i][j]);
+    for (size_t i = 0; i < weights.rows(); i++) {
+      float* row = weights.data() + i * weights.stride();
+
+      for (size_t j = 0; j < weights.cols(); j++) {
+        row[j] += mutator(row[j]);
       }
     }
+
+    touch();
   }
 
   void DenseLayer::mutateBiases(const std::function<float(float)>& mutator) {
     for (size_t i = 0; i < biases.size(); i++) {
       biases[i] += mutator(biases[i]);
     }
+
+    touch();
   }
 
-  void DenseLayer::blendWith(const ILayerWeight& other, float alpha) {
-    for (size_t i = 0; i < weights.size(); i++) {
-      for (size_t j = 0; j < weights[i].size(); j++) {
-        weights[i][j] = (1.0f - alpha) * weights[i][j] + alpha * other.getWeight(i, j);
-      }
-    }
+  void DenseLayer::mutateWeights(float rate, float mean, float stddev, RandomStream& random) {
+    mutateParameters(weights.data(), weights.rows(), weights.cols(), weights.stride(), rate, mean, stddev, random);
+    touch();
+  }
 
-    for (size_t i = 0; i < biases.size(); i++) {
-      biases[i] = (1.0f - alpha) * biases[i] + alpha * other.getBias(i);
-    }
+  void DenseLayer::mutateBiases(float rate, float mean, float stddev, RandomStream& random) {
+    mutateParameters(biases.data(), 1, biases.size(), biases.size(), rate, mean, stddev, random);
+    touch();
   }
 
-  bool DenseLayer::validateInternalShape(const layer_weight_t& weights, const layer_bias_t& biases) {
-    auto expectedOutput = outputSize();
+  void DenseLayer::blendWith(const ILayerWeight& other, float alpha) {
+    const auto& otherWeights = other.getWeights();
+    const auto& otherBiases = other.getBiases();
 
-    if (expectedOutput == 0 || weights.size() != expectedOutput || biases.size() != expectedOutput) {
-      return false;
+    if (otherWeights.rows() != weights.rows() || otherWeights.cols() != weights.cols() || otherBiases.size() != biases.size()) {
+      throw exception::InvalidNetworkArchitectureException("Cannot blend layers with different shapes");
     }
 
-    auto expectedInput = inputSize();
+    const auto blend = kernel::activeKernels().blend;
 
-    for (size_t i = 0; i < weights.size(); i++) {
-      if (weights[i].size() != expectedInput) {
-        return false;
-      }
+    for (size_t i = 0; i < weights.rows(); i++) {
+      float* row = weights.data() + i * weights.stride();
+
+      blend(row, otherWeights.data() + i * otherWeights.stride(), alpha, weights.cols(), row);
     }
 
-    return true;
+    blend(biases.data(), otherBiases.data(), alpha, biases.size(), biases.data());
+    touch();
+  }
+
+  bool DenseLayer::validateInternalShape(const layer_weight_t& weights, const layer_bias_t& biases) {
+    auto expectedOutput = outputSize();
+
+    return expectedOutput != 0 && weights.rows() == expectedOutput && biases.size() == expectedOutput;
   }
 
   float DenseLayer::meanWeight() const {
-    if (weights.empty()) {
+    if (weights.empty() || weights.cols() == 0) {
       return 0;
     }
 
     float total = 0;
 
-    for (size_t i = 0; i < weights.size(); i++) {
-      for (size_t j = 0; j < weights[i].size(); j++) {
-        total += weights[i][j];
+    for (size_t i = 0; i < weights.rows(); i++) {
+      const float* row = weights.data() + i * weights.stride();
+
+      for (size_t j = 0; j < weights.cols(); j++) {
+        total += row[j];
       }
     }
 
-    return total / (weights.size() * weights[0].size());
+    return total / (weights.rows() * weights.cols());
   }
 
   float DenseLayer::meanBias() const {
@@ -176,11 +227,13 @@ namespace neuro {
 
   float& DenseLayer::weightRef(size_t indexX, size_t indexY) {
     checkWeightIndex(indexX, indexY);
+    touch();
     return weights[indexX][indexY];
   }
 
   float& DenseLayer::biasRef(size_t index) {
     checkBiasIndex(index);
+    touch();
     return biases[index];
   }
 
@@ -207,26 +260,29 @@ namespace neuro {
   void DenseLayer::setWeight(size_t indexX, size_t indexY, float value) {
     checkWeightIndex(indexX, indexY);
     weights[indexX][indexY] = value;
+    touch();
   }
 
   void DenseLayer::setBias(size_t index, float value) {
     checkBiasIndex(index);
     biases[index] = value;
+    touch();
   }
 
   ILayer& DenseLayer::operator=(const ILayer& other) {
     activation = other.getActivationFunction();
     biases = other.getBiases();
     weights = other.getWeights();
+    version = other.getVersion();
 
     return *this;
   }
 
   void DenseLayer::checkWeightIndex(size_t indexX, size_t indexY) const {
-    if (indexX >= weights.size()) {
+    if (indexX >= weights.rows()) {
       throw exception::InvalidNetworkArchitectureException("Index out of range of the neuron output weight vector");
     }
-    if (indexY >= weights[indexX].size()) {
+    if (indexY >= weights.cols()) {
       throw exception::InvalidNetworkArchitectureException("Index out of range of the neuron input weight vector");
     }
   }
@@ -0,0 +1,69 @@
+#include "neuro/impl/fitness_cache.hpp"
+
+#include <cstring>
+
+#include "neuro/interfaces/i_layer.hpp"
+#include "neuro/utils/version.hpp"
+
+namespace neuro {
+
+  namespace {
+
+    uint64_t hashValues(uint64_t hash, const float* values, size_t size) {
+      for (size_t i = 0; i < size; i++) {
+        uint32_t bits;
+        std::memcpy(&bits, values + i, sizeof(bits));
+
+        hash = combineHash(hash, bits);
+      }
+
+      return hash;
+    }
+
+  } // namespace
+
+  uint64_t FitnessCache::hash(const INeuralNetwork& network) {
+    uint64_t hash = 0;
+
+    for (size_t l = 0; l < network.sizeLayers(); l++) {
+      const ILayer& layer = network.layer(l);
+      const auto& weights = layer.getWeights();
+      const auto& biases = layer.getBiases();
+
+      hash = combineHash(hash, weights.rows());
+      hash = combineHash(hash, weights.cols());
+      hash = combineHash(hash, static_cast<uint64_t>(layer.getActivationFunction().getKind()));
+
+      for (size_t row = 0; row < weights.rows(); row++) {
+        hash = hashValues(hash, weights.data() + row * weights.stride(), weights.cols());
+      }
+
+      hash = hashValues(hash, biases.data(), biases.size());
+    }
+
+    return hash;
+  }
+
+  bool FitnessCache::find(uint64_t hash, float& fitness) {
+    const auto entry = entries.find(hash);
+
+    if (entry == entries.end()) {
+      missCount++;
+      return false;
+    }
+
+    hitCount++;
+    fitness = entry->second;
+
+    return true;
+  }
+
+  void FitnessCache::insert(uint64_t hash, float fitness) {
+    if (entries.size() >= capacity && entries.find(hash) == entries.end()) {
+      entries.clear();
+    }
+
+    entries[hash] = fitness;
+  }
+
+} // namespace neuro
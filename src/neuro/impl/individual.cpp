@@ -21,7 +21,9 @@ namespace neuro {
   Individual::Individual(const Individual& individual)
     : IIndividual(),
       neuralNetwork(std::move(individual.getNeuralNetwork().clone())),
-      fitness(individual.fitness) {}
+      fitness(individual.fitness),
+      evaluated(individual.evaluated),
+      evaluatedVersion(individual.evaluatedVersion) {}
 
   Individual::Individual(int fitness)
     : IIndividual(),
@@ -1,5 +1,6 @@
 #include "neuro/impl/neural_network.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -10,6 +11,9 @@
 #include "neuro/interfaces/i_neural_network.hpp"
 #include "neuro/types.hpp"
 #include "neuro/utils/activation.hpp"
+#include "neuro/utils/random.hpp"
+#include "neuro/utils/thread_pool.hpp"
+#include "neuro/utils/version.hpp"
 
 namespace neuro {
 
@@ -88,13 +92,111 @@ namespace neuro {
       throw exception::InvalidNetworkArchitectureException("Amount of data input does not match neuron data input");
     }
 
-    neuro_layer_t current = inputs;
+    neuro_layer_t outputs(layers.empty() ? inputs.size() : outputSize());
+
+    feedforward(inputs, outputs);
+
+    return outputs;
+  }
+
+  void NeuralNetwork::feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs, InferenceWorkspace& workspace) const {
+    if (inputSize() != inputs.size()) {
+      throw exception::InvalidNetworkArchitectureException("Amount of data input does not match neuron data input");
+    }
+
+    if (layers.empty()) {
+      if (outputs.size() != inputs.size()) {
+        throw exception::InvalidNetworkArchitectureException("Output buffer size does not match network output size");
+      }
+
+      std::copy(inputs.begin(), inputs.end(), outputs.begin());
+      return;
+    }
+
+    if (outputSize() != outputs.size()) {
+      throw exception::InvalidNetworkArchitectureException("Output buffer size does not match network output size");
+    }
+
+    workspace.reserve(maxLayerWidth());
+
+    const float* source = inputs.data();
 
     for (size_t i = 0; i < layers.size(); i++) {
-      current = layers[i]->feedforward(current);
+      float* target = i + 1 == layers.size() ? outputs.data() : workspace.backData();
+
+      layers[i]->feedforward(source, target);
+
+      workspace.swap();
+      source = workspace.frontData();
+    }
+  }
+
+  size_t NeuralNetwork::maxLayerWidth() const {
+    size_t width = 0;
+
+    for (const auto& layer : layers) {
+      width = std::max({width, layer->inputSize(), layer->outputSize()});
+    }
+
+    return width;
+  }
+
+  uint64_t NeuralNetwork::getVersion() const {
+    uint64_t version = layers.size();
+
+    for (const auto& layer : layers) {
+      version = combineHash(version, layer->getVersion());
     }
 
-    return current;
+    return version;
+  }
+
+  neuro_layer_t NeuralNetwork::feedforwardBatch(const neuro_layer_t& inputs, size_t batchSize, const BatchOptions& options) const {
+    if (inputs.size() != batchSize * inputSize()) {
+      throw exception::InvalidNetworkArchitectureException("Batch input size does not match batch size times network input size");
+    }
+
+    if (layers.empty()) {
+      return inputs;
+    }
+
+    neuro_layer_t outputs(batchSize * outputSize());
+
+    auto& pool = ThreadPool::global();
+    const size_t threads = std::max<size_t>(1, std::min(options.threads == 0 ? pool.concurrency() : options.threads, batchSize));
+
+    if (threads == 1) {
+      feedforwardBatchRange(inputs.data(), batchSize, outputs.data());
+      return outputs;
+    }
+
+    pool.parallelFor(batchSize, (batchSize + threads - 1) / threads, [&](size_t begin, size_t end) {
+      feedforwardBatchRange(inputs.data() + begin * inputSize(), end - begin, outputs.data() + begin * outputSize());
+    });
+
+    return outputs;
+  }
+
+  void NeuralNetwork::feedforwardBatchRange(const float* inputs, size_t batchSize, float* outputs) const {
+    size_t width = 0;
+
+    for (size_t i = 0; i + 1 < layers.size(); i++) {
+      width = std::max(width, layers[i]->outputSize());
+    }
+
+    neuro_layer_t current(batchSize * width);
+    neuro_layer_t next(batchSize * width);
+
+    const float* source = inputs;
+
+    for (size_t i = 0; i < layers.size(); i++) {
+      float* target = i + 1 == layers.size() ? outputs : next.data();
+
+      layers[i]->feedforwardBatch(source, batchSize, target);
+
+      current.swap(next);
+      source = current.data();
+    }
   }
 
   void NeuralNetwork::clear() {
@@ -129,6 +231,20 @@ namespace neuro {
     }
   }
 
+  void NeuralNetwork::randomizeWeights(float min, float max, const RandomKey& key) {
+    for (size_t i = 0; i < layers.size(); i++) {
+      RandomStream random(key, static_cast<uint32_t>(i));
+      layers[i]->randomizeWeights(min, max, random);
+    }
+  }
+
+  void NeuralNetwork::randomizeBiases(float min, float max, const RandomKey& key) {
+    for (size_t i = 0; i < layers.size(); i++) {
+      RandomStream random(key, static_cast<uint32_t>(i) | RandomStream::BIAS_STREAM);
+      layers[i]->randomizeBiases(min, max, random);
+    }
+  }
+
   void NeuralNetwork::mutateWeights(const std::function<float(float)>& mutator) {
     for (auto& layer : layers) {
       layer->mutateWeights(mutator);
@@ -153,7 +269,7 @@ namespace neuro {
     std::vector<layer_weight_t> allWeights;
 
     for (size_t i = 0; i < layers.size(); i++) {
-      allWeights.push_back(layers[i]->getWeights());
+      allWeights.push_back(layer(i).getWeights());
     }
 
     return allWeights;
@@ -163,7 +279,7 @@ namespace neuro {
     std::vector<layer_bias_t> allBiases;
 
     for (size_t i = 0; i < layers.size(); i++) {
-      allBiases.push_back(layers[i]->getBiases());
+      allBiases.push_back(layer(i).getBiases());
     }
 
     return allBiases;
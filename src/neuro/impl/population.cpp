@@ -1,18 +1,38 @@
 #include "neuro/impl/population.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+#include "neuro/impl/fitness_cache.hpp"
 #include "neuro/impl/individual.hpp"
 #include "neuro/interfaces/i_individual.hpp"
 #include "neuro/interfaces/i_population.hpp"
 #include "neuro/makers/activation.hpp"
 #include "neuro/utils/activation.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
+#include "neuro/utils/evaluation_loop.hpp"
+#include "neuro/utils/random.hpp"
+#include "neuro/utils/selection.hpp"
+#include "neuro/utils/thread_pool.hpp"
 
 namespace neuro {
 
+  namespace {
+
+    // Layer coordinate of the stream that shuffles the racing sample order.
+    constexpr uint32_t RACING_STREAM = 0x7FFFFFFCu;
+
+  } // namespace
+
   Population::Population(const Population& population) {
     for (const auto& individual : population) {
       this->individuals.push_back(std::move(individual->clone()));
@@ -46,16 +66,281 @@ namespace neuro {
     }
   }
 
-  void Population::randomizeWeights(float min, float max) {
-    for (const auto& individual : individuals) {
-      individual->getNeuralNetwork().randomizeWeights(min, max);
+  void Population::evaluateFitness(const std::function<float(const INeuralNetwork&)>& evaluateFunction, const EvaluationOptions& options) {
+    evaluateFitnessWith([&]() -> evaluator_t { return [&](const INeuralNetwork& network, EvaluationToken&) { return evaluateFunction(network); }; },
+                        options);
+  }
+
+  void Population::evaluateFitness(const std::function<float(const INeuralNetwork&, EvaluationToken&)>& evaluateFunction, const EvaluationOptions& options) {
+    evaluateFitnessWith([&]() { return evaluateFunction; }, options);
+  }
+
+  void Population::evaluateFitnessWith(const std::function<evaluator_t()>& makeEvaluator, const EvaluationOptions& options) {
+    if (!options.skipEvaluated && options.cache == nullptr) {
+      evaluateIndividuals(makeEvaluator, options, nullptr, individuals.size());
+      return;
+    }
+
+    std::vector<size_t> pending;
+
+    for (size_t i = 0; i < individuals.size(); i++) {
+      if (!options.skipEvaluated || !individuals[i]->isFitnessCurrent()) {
+        pending.push_back(i);
+      }
+    }
+
+    if (options.cache == nullptr) {
+      evaluateIndividuals(makeEvaluator, options, pending.data(), pending.size());
+      return;
+    }
+
+    std::vector<uint64_t> hashes(pending.size());
+
+    ThreadPool::global().parallelFor(pending.size(), 1, [&](size_t begin, size_t end) {
+      for (size_t p = begin; p < end; p++) {
+        hashes[p] = FitnessCache::hash(individuals[pending[p]]->getNeuralNetwork());
+      }
+    });
+
+    // Cached genomes take their stored fitness; of identical new genomes only the first is evaluated and
+    // the others copy its result.
+    std::vector<size_t> unique;
+    std::vector<std::pair<size_t, size_t>> duplicates;
+    std::unordered_map<uint64_t, size_t> firstSeen;
+
+    for (size_t p = 0; p < pending.size(); p++) {
+      float fitness;
+
+      if (options.cache->find(hashes[p], fitness)) {
+        individuals[pending[p]]->markEvaluated(fitness);
+      } else if (const auto seen = firstSeen.find(hashes[p]); seen != firstSeen.end()) {
+        duplicates.emplace_back(pending[p], seen->second);
+      } else {
+        firstSeen.emplace(hashes[p], pending[p]);
+        unique.push_back(p);
+      }
+    }
+
+    std::vector<size_t> order(unique.size());
+
+    for (size_t u = 0; u < unique.size(); u++) {
+      order[u] = pending[unique[u]];
+    }
+
+    evaluateIndividuals(makeEvaluator, options, order.data(), order.size());
+
+    // Penalized evaluations are not current and must not reach the cache.
+    for (size_t u = 0; u < unique.size(); u++) {
+      if (individuals[order[u]]->isFitnessCurrent()) {
+        options.cache->insert(hashes[unique[u]], individuals[order[u]]->getFitness());
+      }
+    }
+
+    for (const auto& [index, source] : duplicates) {
+      if (individuals[source]->isFitnessCurrent()) {
+        individuals[index]->markEvaluated(individuals[source]->getFitness());
+      } else {
+        individuals[index]->setFitness(individuals[source]->getFitness());
+      }
     }
   }
 
-  void Population::randomizeBiases(float min, float max) {
-    for (const auto& individual : individuals) {
-      individual->getNeuralNetwork().randomizeBiases(min, max);
+  void Population::evaluateIndividuals(const std::function<evaluator_t()>& makeEvaluator,
+                                       const EvaluationOptions& options,
+                                       const size_t* order,
+                                       size_t count) {
+    auto individual = [&](size_t p) -> IIndividual& { return *individuals[order == nullptr ? p : order[p]]; };
+
+    runEvaluations(
+      count,
+      1,
+      options,
+      [&]() -> evaluation_worker_t {
+        return [&, evaluator = makeEvaluator()](size_t p, size_t, EvaluationToken& token) {
+          IIndividual& target = individual(p);
+          target.markEvaluated(evaluator(target.getNeuralNetwork(), token));
+        };
+      },
+      [&](size_t p, size_t) { individual(p).setFitness(options.timeoutFitness); });
+  }
+
+  RacingOptions RacingOptions::halving(size_t minSamples, size_t datasetSize, size_t eta) {
+    if (minSamples == 0 || eta < 2) {
+      throw exception::InvalidNetworkArchitectureException("Successive halving needs a positive first rung and eta of at least 2");
+    }
+
+    RacingOptions options;
+    options.keepFraction = 1.0f / static_cast<float>(eta);
+
+    for (size_t samples = minSamples; samples < datasetSize; samples *= eta) {
+      options.rungs.push_back(samples);
+    }
+
+    options.rungs.push_back(datasetSize);
+
+    return options;
+  }
+
+  size_t Population::evaluateFitnessRacing(size_t datasetSize,
+                                           const std::function<float(const INeuralNetwork&, const size_t* samples, size_t count)>& score,
+                                           const RacingOptions& options) {
+    std::vector<size_t> rungs = options.rungs.empty() ? std::vector<size_t>{datasetSize} : options.rungs;
+
+    for (size_t r = 0; r < rungs.size(); r++) {
+      if (rungs[r] == 0 || rungs[r] > datasetSize || (r > 0 && rungs[r] <= rungs[r - 1])) {
+        throw exception::InvalidNetworkArchitectureException("Racing rungs must be strictly increasing and within the dataset");
+      }
+    }
+
+    std::vector<size_t> samples(datasetSize);
+    std::iota(samples.begin(), samples.end(), size_t(0));
+
+    if (options.shuffle) {
+      RandomStream random(options.seed, 0, 0, RACING_STREAM);
+
+      for (size_t i = datasetSize; i > 1; i--) {
+        std::swap(samples[i - 1], samples[random.next64() % i]);
+      }
+    }
+
+    EvaluationOptions evaluation = options.evaluation;
+    evaluation.skipEvaluated = false;
+    evaluation.cache = nullptr;
+
+    std::vector<size_t> contestants(individuals.size());
+    std::iota(contestants.begin(), contestants.end(), size_t(0));
+
+    // Individuals dropped at each rung, for the final ranking fix-up.
+    std::vector<std::vector<size_t>> eliminated(rungs.size());
+
+    std::vector<double> totals(individuals.size(), 0.0);
+    std::vector<float> means;
+    std::vector<size_t> finished;
+    std::vector<size_t> ranking;
+    size_t scored = 0;
+
+    for (size_t r = 0; r < rungs.size() && !contestants.empty(); r++) {
+      const size_t from = r == 0 ? 0 : rungs[r - 1];
+      const size_t count = rungs[r] - from;
+
+      // Each individual returns its score on this rung's new samples; totals carry the earlier rungs.
+      evaluateIndividuals(
+        [&]() -> evaluator_t {
+          return [&](const INeuralNetwork& network, EvaluationToken&) { return score(network, samples.data() + from, count); };
+        },
+        evaluation,
+        contestants.data(),
+        contestants.size());
+
+      scored += contestants.size() * count;
+
+      // Out of budget individuals are not current: they keep the penalty and leave the race.
+      finished.clear();
+      means.clear();
+
+      for (size_t index : contestants) {
+        IIndividual& individual = *individuals[index];
+
+        if (individual.isFitnessCurrent()) {
+          totals[index] += individual.getFitness();
+          finished.push_back(index);
+          means.push_back(static_cast<float>(totals[index] / static_cast<double>(rungs[r])));
+        }
+      }
+
+      const bool last = r + 1 == rungs.size();
+      const size_t keep = last ? finished.size() : std::min(finished.size(), std::max<size_t>(1, static_cast<size_t>(std::ceil(options.keepFraction * contestants.size()))));
+
+      selectTop(means.data(), means.size(), keep, ranking);
+
+      for (size_t f = 0; f < finished.size(); f++) {
+        if (last) {
+          individuals[finished[f]]->markEvaluated(means[f]);
+        } else {
+          individuals[finished[f]]->setFitness(means[f]);
+        }
+      }
+
+      contestants.resize(keep);
+
+      for (size_t k = 0; k < keep; k++) {
+        contestants[k] = finished[ranking[k]];
+      }
+
+      for (size_t k = keep; k < finished.size(); k++) {
+        eliminated[r].push_back(finished[ranking[k]]);
+      }
+
+      std::sort(contestants.begin(), contestants.end());
+    }
+
+    // A partial mean over few samples can beat a finalist's full mean, so everyone eliminated at a rung is
+    // capped strictly below the lowest fitness of those who went further, from the last rung back.
+    float floor = std::numeric_limits<float>::infinity();
+
+    for (size_t index : contestants) {
+      floor = std::min(floor, individuals[index]->getFitness());
+    }
+
+    for (size_t r = rungs.size(); r-- > 0;) {
+      float lowest = floor;
+
+      for (size_t index : eliminated[r]) {
+        const float fitness = individuals[index]->getFitness();
+        const float capped = fitness < floor ? fitness : std::nextafter(floor, -std::numeric_limits<float>::infinity());
+
+        individuals[index]->setFitness(capped);
+        lowest = std::min(lowest, capped);
+      }
+
+      floor = lowest;
     }
+
+    return scored;
+  }
+
+  std::vector<neuro_layer_t> Population::feedforwardBatch(const neuro_layer_t& inputs, size_t samples) const {
+    std::vector<neuro_layer_t> outputs(individuals.size());
+
+    // One GEMM over the whole batch per individual and layer instead of samples mat-vecs.
+    ThreadPool::global().parallelFor(individuals.size(), 1, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        outputs[i] = individuals[i]->getNeuralNetwork().feedforwardBatch(inputs, samples);
+      }
+    });
+
+    return outputs;
+  }
+
+  void Population::evaluateFitnessBatch(const neuro_layer_t& inputs,
+                                        size_t samples,
+                                        const std::function<float(neuro_layer_const_span_t outputs)>& score,
+                                        const EvaluationOptions& options) {
+    evaluateFitness([&](const INeuralNetwork& network) { return score(network.feedforwardBatch(inputs, samples)); }, options);
+  }
+
+  void Population::randomizeWeights(float min, float max) {
+    randomizeWeights(min, max, RandomStream::local().next64());
+  }
+
+  void Population::randomizeBiases(float min, float max) {
+    randomizeBiases(min, max, RandomStream::local().next64());
+  }
+
+  void Population::randomizeWeights(float min, float max, uint64_t seed) {
+    ThreadPool::global().parallelFor(individuals.size(), 1, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        individuals[i]->getNeuralNetwork().randomizeWeights(min, max, RandomKey{seed, 0, static_cast<uint32_t>(i)});
+      }
+    });
+  }
+
+  void Population::randomizeBiases(float min, float max, uint64_t seed) {
+    ThreadPool::global().parallelFor(individuals.size(), 1, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        individuals[i]->getNeuralNetwork().randomizeBiases(min, max, RandomKey{seed, 0, static_cast<uint32_t>(i)});
+      }
+    });
   }
 
   void Population::addIndividuals(const std::vector<IIndividual>& individuals) {
@@ -78,10 +363,24 @@ namespace neuro {
 
   const IIndividual& Population::getBestIndividual() const {
     return **std::max_element(individuals.begin(), individuals.end(), [](const std::shared_ptr<IIndividual>& individualA, const std::shared_ptr<IIndividual>& individualB) {
-      return individualA->getFitness() > individualB->getFitness();
+      return individualA->getFitness() < individualB->getFitness();
     });
   }
 
+  std::vector<size_t> Population::topK(size_t k) const {
+    return neuro::topK(getFitnesses(), k);
+  }
+
+  std::vector<float> Population::getFitnesses() const {
+    std::vector<float> fitness(individuals.size());
+
+    for (size_t i = 0; i < individuals.size(); i++) {
+      fitness[i] = individuals[i]->getFitness();
+    }
+
+    return fitness;
+  }
+
   const IIndividual& Population::get(size_t index) const {
     if (index >= individuals.size()) {
       throw exception::InvalidNetworkArchitectureException("Individual vector out-of-range index");
@@ -0,0 +1,497 @@
+#include "neuro/impl/population_arena.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "internal/kernels.hpp"
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+#include "neuro/impl/dense_layer.hpp"
+#include "neuro/makers/activation.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
+#include "neuro/utils/evaluation_loop.hpp"
+#include "neuro/utils/mutation.hpp"
+#include "neuro/utils/selection.hpp"
+#include "neuro/utils/thread_pool.hpp"
+
+namespace neuro {
+
+  static_assert(PopulationArena::LANE_COUNT == kernel::LANES, "Arena lanes must match the lane kernels");
+
+  namespace {
+
+    // Genomes start on a cache line boundary.
+    constexpr size_t GENOME_ALIGNMENT = DEFAULT_ALIGNMENT / sizeof(float);
+
+    std::vector<ActivationFunction> repeat(const ActivationFunction& activation, const std::vector<int>& structure) {
+      return std::vector<ActivationFunction>(structure.size() < 2 ? 0 : structure.size() - 1, activation);
+    }
+
+  } // namespace
+
+  const float* IndividualView::parameters() const {
+    return arena->parameters(index);
+  }
+
+  layer_weight_const_view_t IndividualView::weights(size_t layer) const {
+    const auto& shape = arena->layers.at(layer);
+
+    return {parameters() + shape.weightOffset, shape.rows, shape.cols, shape.cols};
+  }
+
+  neuro_layer_const_span_t IndividualView::biases(size_t layer) const {
+    const auto& shape = arena->layers.at(layer);
+
+    return {parameters() + shape.biasOffset, shape.rows};
+  }
+
+  float IndividualView::getFitness() const {
+    return arena->getFitness(index);
+  }
+
+  neuro_layer_t IndividualView::feedforward(const neuro_layer_t& inputs) const {
+    neuro_layer_t outputs(arena->outputSize());
+    feedforward(inputs, outputs);
+
+    return outputs;
+  }
+
+  void IndividualView::feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs) const {
+    feedforward(inputs, outputs, InferenceWorkspace::local());
+  }
+
+  void IndividualView::feedforward(neuro_layer_const_span_t inputs, neuro_layer_span_t outputs, InferenceWorkspace& workspace) const {
+    if (inputs.size() != arena->inputSize()) {
+      throw exception::InvalidNetworkArchitectureException("Amount of data input does not match neuron data input");
+    }
+
+    if (outputs.size() != arena->outputSize()) {
+      throw exception::InvalidNetworkArchitectureException("Output buffer size does not match network output size");
+    }
+
+    workspace.reserve(arena->maxLayerWidth());
+
+    arena->run(parameters(), inputs.data(), outputs.data(), workspace);
+  }
+
+  void IndividualView::feedforwardBatch(const float* inputs, size_t samples, float* outputs, InferenceWorkspace& workspace) const {
+    workspace.reserve(samples * arena->maxLayerWidth());
+
+    arena->runBatch(parameters(), inputs, samples, outputs, workspace);
+  }
+
+  PopulationArena::PopulationArena(size_t size, const std::vector<int>& structure)
+    : PopulationArena(size, structure, maker::activationIdentity()) {}
+
+  PopulationArena::PopulationArena(size_t size, const std::vector<int>& structure, const ActivationFunction& activation)
+    : PopulationArena(size, structure, repeat(activation, structure)) {}
+
+  PopulationArena::PopulationArena(size_t size, const std::vector<int>& structure, const std::vector<ActivationFunction>& activations) {
+    initialize(structure, activations);
+    resize(size);
+  }
+
+  PopulationArena::PopulationArena(const IPopulation& population) {
+    if (population.empty()) {
+      return;
+    }
+
+    const auto& reference = population.get(0).getNeuralNetwork();
+    std::vector<int> structure{static_cast<int>(reference.inputSize())};
+    std::vector<ActivationFunction> activations;
+
+    for (const auto& layer : reference) {
+      structure.push_back(static_cast<int>(layer->outputSize()));
+      activations.push_back(layer->getActivationFunction());
+    }
+
+    initialize(structure, activations);
+    resize(population.size());
+
+    for (size_t i = 0; i < population.size(); i++) {
+      assign(i, population.get(i).getNeuralNetwork());
+      fitness[i] = population.get(i).getFitness();
+    }
+  }
+
+  void PopulationArena::resize(size_t size) {
+    genomes.resize(size * genomeStride, 0.0f);
+    fitness.resize(size, 0.0f);
+  }
+
+  void PopulationArena::randomizeWeights(float min, float max) {
+    randomizeWeights(min, max, RandomStream::local().next64());
+  }
+
+  void PopulationArena::randomizeBiases(float min, float max) {
+    randomizeBiases(min, max, RandomStream::local().next64());
+  }
+
+  void PopulationArena::randomizeWeights(float min, float max, uint64_t seed) {
+    ThreadPool::global().parallelFor(size(), 1, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        const RandomKey key{seed, 0, static_cast<uint32_t>(i)};
+
+        for (size_t l = 0; l < layers.size(); l++) {
+          RandomStream random(key, static_cast<uint32_t>(l));
+          random.fillUniform(parameters(i) + layers[l].weightOffset, layers[l].rows * layers[l].cols, min, max);
+        }
+      }
+    });
+  }
+
+  void PopulationArena::randomizeBiases(float min, float max, uint64_t seed) {
+    ThreadPool::global().parallelFor(size(), 1, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        const RandomKey key{seed, 0, static_cast<uint32_t>(i)};
+
+        for (size_t l = 0; l < layers.size(); l++) {
+          RandomStream random(key, static_cast<uint32_t>(l) | RandomStream::BIAS_STREAM);
+          random.fillUniform(parameters(i) + layers[l].biasOffset, layers[l].rows, min, max);
+        }
+      }
+    });
+  }
+
+  void PopulationArena::mutate(size_t index, float rate, float mean, float stddev, const RandomKey& key) {
+    float* genome = parameters(index);
+
+    for (size_t l = 0; l < layers.size(); l++) {
+      const auto& layer = layers[l];
+
+      RandomStream weightRandom(key, static_cast<uint32_t>(l));
+      RandomStream biasRandom(key, static_cast<uint32_t>(l) | RandomStream::BIAS_STREAM);
+
+      mutateParameters(genome + layer.weightOffset, layer.rows, layer.cols, layer.cols, rate, mean, stddev, weightRandom);
+      mutateParameters(genome + layer.biasOffset, 1, layer.rows, layer.rows, rate, mean, stddev, biasRandom);
+    }
+  }
+
+  void PopulationArena::mutate(float rate, float mean, float stddev, uint64_t seed, uint32_t generation, size_t begin) {
+    if (begin >= size()) {
+      return;
+    }
+
+    const auto mutateRange = [&](size_t first, size_t last) {
+      for (size_t i = begin + first; i < begin + last; i++) {
+        mutate(i, rate, mean, stddev, RandomKey{seed, generation, static_cast<uint32_t>(i)});
+      }
+    };
+
+    // By reference, so std::function does not copy the closure to the heap.
+    ThreadPool::global().parallelFor(size() - begin, 1, std::ref(mutateRange));
+  }
+
+  void PopulationArena::crossover(const float* first, const float* second, size_t child, const CrossoverOptions& options, RandomStream& random) {
+    Crossover operation(options, parameterSize, random);
+
+    operation.apply(first, second, parameterSize, parameters(child));
+    fitness[child] = 0.0f;
+  }
+
+  void PopulationArena::copy(size_t from, size_t to) {
+    copy(*this, from, to);
+  }
+
+  void PopulationArena::copy(const PopulationArena& source, size_t from, size_t to) {
+    if (&source != this && !compatible(source)) {
+      throw exception::InvalidNetworkArchitectureException("Cannot copy genomes between arenas with different topologies");
+    }
+
+    const float* genome = source.parameters(from);
+
+    std::copy(genome, genome + parameterSize, parameters(to));
+    fitness[to] = source.fitness[from];
+  }
+
+  void PopulationArena::evaluateFitness(const std::function<float(const IndividualView&)>& evaluateFunction, const EvaluationOptions& options) {
+    evaluateFitness([&](const IndividualView& individual, EvaluationToken&) { return evaluateFunction(individual); }, options);
+  }
+
+  void PopulationArena::evaluateFitness(const std::function<float(const IndividualView&, EvaluationToken&)>& evaluateFunction,
+                                        const EvaluationOptions& options) {
+    runEvaluations(
+      size(),
+      1,
+      options,
+      [&]() -> evaluation_worker_t {
+        return [&](size_t i, size_t, EvaluationToken& token) { fitness[i] = evaluateFunction(IndividualView(*this, i), token); };
+      },
+      [&](size_t i, size_t) { fitness[i] = options.timeoutFitness; });
+  }
+
+  void PopulationArena::feedforwardBatch(const float* inputs, size_t samples, float* outputs) const {
+    if (prefersLanes()) {
+      feedforwardLanes(inputs, samples, outputs);
+      return;
+    }
+
+    const size_t outputStride = samples * outputSize();
+
+    ThreadPool::global().parallelFor(size(), 1, [&](size_t begin, size_t end) {
+      auto& workspace = InferenceWorkspace::local();
+
+      for (size_t i = begin; i < end; i++) {
+        IndividualView(*this, i).feedforwardBatch(inputs, samples, outputs + i * outputStride, workspace);
+      }
+    });
+  }
+
+  void PopulationArena::feedforwardLanes(const float* inputs, size_t samples, float* outputs) const {
+    const auto broadcast = broadcastInputs(inputs, samples);
+    const size_t groups = (size() + LANE_COUNT - 1) / LANE_COUNT;
+    const size_t outputStride = samples * outputSize();
+
+    ThreadPool::global().parallelFor(groups, 1, [&](size_t begin, size_t end) {
+      auto& workspace = InferenceWorkspace::local();
+      aligned_vector_t<float> packed(parameterSize * LANE_COUNT);
+
+      for (size_t group = begin; group < end; group++) {
+        const size_t first = group * LANE_COUNT;
+
+        packLanes(first, packed.data());
+        runLanes(packed.data(), broadcast.data(), samples, std::min(LANE_COUNT, size() - first), outputs + first * outputStride, workspace);
+      }
+    });
+  }
+
+  neuro_layer_t PopulationArena::feedforwardBatch(const neuro_layer_t& inputs, size_t samples) const {
+    if (inputs.size() != samples * inputSize()) {
+      throw exception::InvalidNetworkArchitectureException("Batch input size does not match batch size times network input size");
+    }
+
+    neuro_layer_t outputs(size() * samples * outputSize());
+    feedforwardBatch(inputs.data(), samples, outputs.data());
+
+    return outputs;
+  }
+
+  void PopulationArena::evaluateFitnessBatch(const neuro_layer_t& inputs,
+                                             size_t samples,
+                                             const std::function<float(neuro_layer_const_span_t outputs)>& score,
+                                             const EvaluationOptions& options) {
+    if (inputs.size() != samples * inputSize()) {
+      throw exception::InvalidNetworkArchitectureException("Batch input size does not match batch size times network input size");
+    }
+
+    // Lane evaluation claims whole groups of LANE_COUNT individuals, each group under one token.
+    const bool lanes = prefersLanes();
+    const size_t unit = lanes ? LANE_COUNT : 1;
+    const size_t outputStride = samples * outputSize();
+
+    const auto broadcast = lanes ? broadcastInputs(inputs.data(), samples) : aligned_vector_t<float>{};
+
+    runEvaluations(
+      size(),
+      unit,
+      options,
+      [&]() -> evaluation_worker_t {
+        auto outputs = std::make_shared<neuro_layer_t>(unit * outputStride);
+        auto packed = std::make_shared<aligned_vector_t<float>>(lanes ? parameterSize * LANE_COUNT : 0);
+
+        return [&, outputs, packed](size_t first, size_t count, EvaluationToken& token) {
+          auto& workspace = InferenceWorkspace::local();
+
+          if (lanes) {
+            packLanes(first, packed->data());
+            runLanes(packed->data(), broadcast.data(), samples, count, outputs->data(), workspace);
+          } else {
+            IndividualView(*this, first).feedforwardBatch(inputs.data(), samples, outputs->data(), workspace);
+          }
+
+          for (size_t k = 0; k < count && !token.shouldStop(); k++) {
+            fitness[first + k] = score({outputs->data() + k * outputStride, outputStride});
+          }
+        };
+      },
+      [&](size_t first, size_t count) { std::fill_n(fitness.begin() + first, count, options.timeoutFitness); });
+  }
+
+  size_t PopulationArena::bestIndex() const {
+    if (fitness.empty()) {
+      throw exception::InvalidNetworkArchitectureException("Cannot pick the best individual of an empty arena");
+    }
+
+    return static_cast<size_t>(std::max_element(fitness.begin(), fitness.end()) - fitness.begin());
+  }
+
+  std::vector<size_t> PopulationArena::topK(size_t k) const {
+    return neuro::topK(fitness, k);
+  }
+
+  NeuralNetwork PopulationArena::toNeuralNetwork(size_t index) const {
+    std::vector<std::unique_ptr<ILayer>> result;
+    const float* genome = parameters(index);
+
+    for (const auto& layer : layers) {
+      layer_weight_t weights(layer.rows, layer.cols);
+
+      for (size_t row = 0; row < layer.rows; row++) {
+        const float* source = genome + layer.weightOffset + row * layer.cols;
+        std::copy(source, source + layer.cols, weights.row(row).begin());
+      }
+
+      layer_bias_t biases(genome + layer.biasOffset, genome + layer.biasOffset + layer.rows);
+
+      result.push_back(std::make_unique<DenseLayer>(weights, biases, layer.activation));
+    }
+
+    return NeuralNetwork(std::move(result));
+  }
+
+  void PopulationArena::assign(size_t index, const INeuralNetwork& network) {
+    if (network.sizeLayers() != layers.size()) {
+      throw exception::InvalidNetworkArchitectureException("Arena expects " + std::to_string(layers.size()) + " layers, got " +
+                                                           std::to_string(network.sizeLayers()));
+    }
+
+    float* genome = parameters(index);
+
+    for (size_t l = 0; l < layers.size(); l++) {
+      const auto& layer = layers[l];
+      const auto& weights = network.layer(l).getWeights();
+      const auto& biases = network.layer(l).getBiases();
+
+      if (weights.rows() != layer.rows || weights.cols() != layer.cols || biases.size() != layer.rows) {
+        throw exception::InvalidNetworkArchitectureException("Arena layer " + std::to_string(l) + " shape mismatch");
+      }
+
+      for (size_t row = 0; row < layer.rows; row++) {
+        std::copy(weights.row(row).begin(), weights.row(row).end(), genome + layer.weightOffset + row * layer.cols);
+      }
+
+      std::copy(biases.begin(), biases.end(), genome + layer.biasOffset);
+    }
+  }
+
+  bool PopulationArena::compatible(const PopulationArena& other) const {
+    if (other.layers.size() != layers.size()) {
+      return false;
+    }
+
+    for (size_t l = 0; l < layers.size(); l++) {
+      const auto& a = layers[l];
+      const auto& b = other.layers[l];
+
+      if (a.rows != b.rows || a.cols != b.cols || a.activation.getKind() != b.activation.getKind()) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  void PopulationArena::initialize(const std::vector<int>& structure, const std::vector<ActivationFunction>& activations) {
+    if (structure.size() < 2 || activations.size() != structure.size() - 1) {
+      throw exception::InvalidNetworkArchitectureException("Arena needs an input and an output size and one activation per layer");
+    }
+
+    for (size_t i = 0; i < structure.size(); i++) {
+      if (structure[i] <= 0) {
+        throw exception::InvalidNetworkArchitectureException("Arena layer sizes must be positive");
+      }
+
+      maxWidth = std::max(maxWidth, static_cast<size_t>(structure[i]));
+    }
+
+    for (size_t i = 0; i + 1 < structure.size(); i++) {
+      const size_t rows = static_cast<size_t>(structure[i + 1]);
+      const size_t cols = static_cast<size_t>(structure[i]);
+
+      layers.push_back({rows, cols, parameterSize, parameterSize + rows * cols, activations[i]});
+      parameterSize += rows * cols + rows;
+    }
+
+    genomeStride = (parameterSize + GENOME_ALIGNMENT - 1) / GENOME_ALIGNMENT * GENOME_ALIGNMENT;
+  }
+
+  void PopulationArena::runBatch(const float* genome, const float* inputs, size_t samples, float* outputs, InferenceWorkspace& workspace) const {
+    const auto gemm = kernel::activeKernels().gemm;
+    const float* source = inputs;
+
+    for (size_t i = 0; i < layers.size(); i++) {
+      const auto& layer = layers[i];
+      float* target = i + 1 == layers.size() ? outputs : workspace.backData();
+
+      gemm(genome + layer.weightOffset, layer.cols, layer.rows, layer.cols, source, samples, genome + layer.biasOffset, target);
+      layer.activation.apply(target, layer.rows * samples);
+
+      workspace.swap();
+      source = workspace.frontData();
+    }
+  }
+
+  aligned_vector_t<float> PopulationArena::broadcastInputs(const float* inputs, size_t samples) const {
+    aligned_vector_t<float> broadcast(samples * inputSize() * LANE_COUNT);
+
+    for (size_t i = 0; i < samples * inputSize(); i++) {
+      std::fill_n(broadcast.data() + i * LANE_COUNT, LANE_COUNT, inputs[i]);
+    }
+
+    return broadcast;
+  }
+
+  void PopulationArena::packLanes(size_t first, float* packed) const {
+    const size_t count = std::min(LANE_COUNT, size() - first);
+
+    for (size_t k = 0; k < LANE_COUNT; k++) {
+      const float* genome = k < count ? parameters(first + k) : nullptr;
+
+      for (size_t p = 0; p < parameterSize; p++) {
+        packed[p * LANE_COUNT + k] = genome != nullptr ? genome[p] : 0.0f;
+      }
+    }
+  }
+
+  void PopulationArena::runLanes(const float* packed,
+                                 const float* broadcast,
+                                 size_t samples,
+                                 size_t count,
+                                 float* outputs,
+                                 InferenceWorkspace& workspace) const {
+    const auto laneGemv = kernel::activeKernels().laneGemv;
+    const size_t outputWidth = outputSize();
+
+    workspace.reserve(maxWidth * LANE_COUNT);
+
+    for (size_t sample = 0; sample < samples; sample++) {
+      const float* source = broadcast + sample * inputSize() * LANE_COUNT;
+
+      for (const auto& layer : layers) {
+        float* target = workspace.backData();
+
+        laneGemv(packed + layer.weightOffset * LANE_COUNT, layer.rows, layer.cols, source, packed + layer.biasOffset * LANE_COUNT, target);
+        layer.activation.apply(target, layer.rows * LANE_COUNT);
+
+        workspace.swap();
+        source = workspace.frontData();
+      }
+
+      for (size_t k = 0; k < count; k++) {
+        for (size_t o = 0; o < outputWidth; o++) {
+          outputs[(k * samples + sample) * outputWidth + o] = source[o * LANE_COUNT + k];
+        }
+      }
+    }
+  }
+
+  void PopulationArena::run(const float* genome, const float* inputs, float* outputs, InferenceWorkspace& workspace) const {
+    const auto gemv = kernel::activeKernels().gemv;
+    const float* source = inputs;
+
+    for (size_t i = 0; i < layers.size(); i++) {
+      const auto& layer = layers[i];
+      float* target = i + 1 == layers.size() ? outputs : workspace.backData();
+
+      gemv(genome + layer.weightOffset, layer.cols, layer.rows, layer.cols, source, genome + layer.biasOffset, target);
+      layer.activation.apply(target, layer.rows);
+
+      workspace.swap();
+      source = workspace.frontData();
+    }
+  }
+
+} // namespace neuro
@@ -1,16 +1,40 @@
 #include "neuro/strategies/genetic_trainer.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <utility>
 
-#include "internal/random_engine.hpp"
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
 #include "neuro/impl/population.hpp"
+#include "neuro/impl/population_arena.hpp"
 #include "neuro/interfaces/i_population.hpp"
+#include "neuro/utils/crossover.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
+#include "neuro/utils/random.hpp"
+#include "neuro/utils/selection.hpp"
+#include "neuro/utils/thread_pool.hpp"
 
 namespace neuro {
 
+  namespace {
+
+    // Layer coordinates of the per-child streams, kept clear of the weight and bias streams of mutation.
+    constexpr uint32_t SELECTION_STREAM = 0x7FFFFFFFu;
+    constexpr uint32_t CROSSOVER_STREAM = 0x7FFFFFFEu;
+
+  } // namespace
+
   GeneticTrainer::GeneticTrainer()
     : population(std::make_shared<Population>()) {}
 
+  GeneticTrainer::GeneticTrainer(const GeneticTrainer& other)
+    : population(other.population),
+      options(other.options),
+      generation(other.generation) {}
+
   GeneticTrainer::GeneticTrainer(const std::shared_ptr<IPopulation>& population)
     : population(population) {}
 
@@ -23,28 +47,361 @@ namespace neuro {
       options(options) {}
 
   void GeneticTrainer::evolve() {
+    crossover();
+    mutateIndividuals(std::min(options.eliteCount, population->size()));
+
+    generation++;
   }
 
   void GeneticTrainer::mutate() {
+    mutateIndividuals(0);
+
+    generation++;
+  }
+
+  void GeneticTrainer::crossover() {
     auto& individuals = population->getIndividuals();
+    const size_t size = individuals.size();
+
+    if (size == 0) {
+      return;
+    }
+
+    const size_t elites = std::min(options.eliteCount, size);
+    const size_t children = size - elites;
+
+    // One pass over the virtual getters; selection then works on the compact array.
+    scores.resize(size);
+
+    for (size_t i = 0; i < size; i++) {
+      scores[i] = individuals[i]->getFitness();
+    }
 
-    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
-    std::normal_distribution<float> perturbation(-options.intensity, options.intensity);
+    selectTop(scores.data(), size, elites, ranking);
+    selector.prepare(options.selection, scores.data(), size, options.tournamentSize, options.rankPressure);
 
-    for (auto& individual : individuals) {
-      auto& network = individual->getNeuralNetwork();
+    // Only allocates while warming up or after the population grew.
+    while (nursery.size() < children) {
+      nursery.push_back(individuals[ranking[0]]->clone());
+    }
+
+    nextGeneration.reserve(size);
+    nextGeneration.clear();
+
+    for (size_t i = 0; i < elites; i++) {
+      nextGeneration.push_back(individuals[ranking[i]]);
+    }
 
-      network.mutateWeights([&](float) {
-        return chance(random_engine) < options.rate ? perturbation(random_engine) : 0.0f;
-      });
+    const auto breedChildren = [&](size_t begin, size_t end) {
+      for (size_t k = begin; k < end; k++) {
+        const RandomKey key{options.seed, generation, static_cast<uint32_t>(elites + k)};
+        RandomStream selection(key, SELECTION_STREAM);
 
-      network.mutateBiases([&](float) {
-        return chance(random_engine) < options.rate ? perturbation(random_engine) : 0.0f;
-      });
+        const IIndividual& first = *individuals[selector(selection)];
+        const IIndividual& second = *individuals[selector(selection)];
+
+        breed(first, second, *nursery[k], key);
+      }
+    };
+
+    // Passed by reference so std::function does not copy the closure to the heap.
+    ThreadPool::global().parallelFor(children, 1, std::ref(breedChildren));
+
+    // Children join the population and the displaced individuals become the next nursery.
+    for (size_t k = 0; k < children; k++) {
+      nextGeneration.push_back(std::move(nursery[k]));
+      nursery[k] = std::move(individuals[ranking[elites + k]]);
     }
+
+    individuals.swap(nextGeneration);
+    nextGeneration.clear();
   }
 
-  void GeneticTrainer::crossover() {
+  void GeneticTrainer::evolve(PopulationArena& arena) {
+    const size_t size = arena.size();
+
+    if (size == 0) {
+      return;
+    }
+
+    const size_t elites = std::min(options.eliteCount, size);
+
+    selectTop(arena.getFitnesses().data(), size, elites, ranking);
+    selector.prepare(options.selection, arena.getFitnesses().data(), size, options.tournamentSize, options.rankPressure);
+
+    // The next generation is written into a second arena and swapped in; it only allocates while warming up.
+    if (offspring.size() != size || !offspring.compatible(arena)) {
+      offspring = arena;
+    }
+
+    for (size_t i = 0; i < elites; i++) {
+      offspring.copy(arena, ranking[i], i);
+    }
+
+    const auto breedChildren = [&](size_t begin, size_t end) {
+      for (size_t k = elites + begin; k < elites + end; k++) {
+        const RandomKey key{options.seed, generation, static_cast<uint32_t>(k)};
+        RandomStream selection(key, SELECTION_STREAM);
+
+        const float* first = arena.parameters(selector(selection));
+        const float* second = arena.parameters(selector(selection));
+
+        RandomStream random(key, CROSSOVER_STREAM);
+        offspring.crossover(first, second, k, options.crossover, random);
+      }
+    };
+
+    ThreadPool::global().parallelFor(size - elites, 1, std::ref(breedChildren));
+
+    offspring.mutate(options.rate, 0.0f, options.intensity, options.seed, generation, elites);
+    arena.swap(offspring);
+
+    generation++;
+  }
+
+  size_t GeneticTrainer::evolveSteadyState(size_t children,
+                                           const std::function<float(const INeuralNetwork&, EvaluationToken&)>& evaluateFunction,
+                                           const SteadyStateOptions& steadyOptions) {
+    auto& individuals = population->getIndividuals();
+    const size_t size = individuals.size();
+
+    if (size == 0 || children == 0) {
+      return 0;
+    }
+
+    if (slotCapacity < size) {
+      slotFitness = std::make_unique<std::atomic<float>[]>(size);
+      slotLocks = std::make_unique<std::mutex[]>(size);
+      slotCapacity = size;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+      slotFitness[i].store(individuals[i]->getFitness(), std::memory_order_relaxed);
+    }
+
+    const bool replaceWorst = steadyOptions.replacement == ReplacementKind::Worst;
+
+    if (replaceWorst) {
+      replacementHeap.clear();
+
+      for (size_t i = 0; i < size; i++) {
+        replacementHeap.emplace_back(individuals[i]->getFitness(), i);
+      }
+
+      std::make_heap(replacementHeap.begin(), replacementHeap.end(), std::greater<>());
+    }
+
+    const auto draw = [&](RandomStream& random) { return static_cast<size_t>((uint64_t(random()) * size) >> 32); };
+
+    const auto fittestOf = [&](RandomStream& random, size_t tournament) {
+      size_t best = draw(random);
+
+      for (size_t t = 1; t < tournament; t++) {
+        const size_t contestant = draw(random);
+
+        if (slotFitness[contestant].load(std::memory_order_relaxed) > slotFitness[best].load(std::memory_order_relaxed)) {
+          best = contestant;
+        }
+      }
+
+      return best;
+    };
+
+    const auto leastFitOf = [&](RandomStream& random) {
+      size_t worst = draw(random);
+
+      for (size_t t = 1; t < std::max<size_t>(steadyOptions.replacementTournament, 1); t++) {
+        const size_t candidate = draw(random);
+
+        if (slotFitness[candidate].load(std::memory_order_relaxed) < slotFitness[worst].load(std::memory_order_relaxed)) {
+          worst = candidate;
+        }
+      }
+
+      return worst;
+    };
+
+    const auto occupant = [&](size_t slot) {
+      std::lock_guard<std::mutex> lock(slotLocks[slot]);
+      return individuals[slot];
+    };
+
+    auto& pool = ThreadPool::global();
+    const size_t workers = std::min(steadyOptions.threads == 0 ? pool.concurrency() : steadyOptions.threads, children);
+
+    std::atomic<size_t> cursor{0};
+    std::atomic<size_t> inserted{0};
+    std::atomic<bool> failed{false};
+
+    // Caller holds the slot lock.
+    const auto replace = [&](size_t slot, std::shared_ptr<IIndividual>& child, float childFitness) {
+      individuals[slot] = std::move(child);
+      slotFitness[slot].store(childFitness, std::memory_order_relaxed);
+      inserted.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    // Workers claim one child at a time, so a slow evaluation only holds up its own worker.
+    const EvaluationOptions& budget = steadyOptions.evaluation;
+
+    pool.parallelFor(workers, 1, [&](size_t, size_t) {
+      EvaluationToken token;
+
+      try {
+        for (size_t k = cursor.fetch_add(1); k < children && !failed; k = cursor.fetch_add(1)) {
+          // Children not bred yet when the run is cancelled are only counted.
+          if (budget.cancellation != nullptr && budget.cancellation->isCancelled()) {
+            if (budget.counters != nullptr) {
+              budget.counters->record(EvaluationOutcome::Cancelled);
+            }
+
+            continue;
+          }
+
+          const RandomKey key{options.seed, generation, static_cast<uint32_t>(k)};
+          RandomStream selection(key, SELECTION_STREAM);
+
+          const auto first = occupant(fittestOf(selection, std::max<size_t>(options.tournamentSize, 1)));
+          const auto second = occupant(fittestOf(selection, std::max<size_t>(options.tournamentSize, 1)));
+
+          std::shared_ptr<IIndividual> child = first->clone();
+
+          breed(*first, *second, *child, key);
+          mutateIndividual(*child, key);
+
+          token.arm(budget.timeLimit, budget.stepLimit, budget.cancellation);
+          const float score = evaluateFunction(child->getNeuralNetwork(), token);
+          const EvaluationOutcome outcome = token.finish();
+
+          if (budget.counters != nullptr) {
+            budget.counters->record(outcome);
+          }
+
+          if (outcome != EvaluationOutcome::Completed) {
+            child->setFitness(budget.timeoutFitness);
+            continue;
+          }
+
+          child->markEvaluated(score);
+
+          const float childFitness = child->getFitness();
+
+          if (replaceWorst) {
+            // Every insertion goes through the heap under this lock, so its root is the least fit individual.
+            std::lock_guard<std::mutex> heapLock(replacementLock);
+
+            if (childFitness >= replacementHeap.front().first) {
+              std::pop_heap(replacementHeap.begin(), replacementHeap.end(), std::greater<>());
+
+              const size_t slot = replacementHeap.back().second;
+              replacementHeap.back().first = childFitness;
+              std::push_heap(replacementHeap.begin(), replacementHeap.end(), std::greater<>());
+
+              std::lock_guard<std::mutex> lock(slotLocks[slot]);
+              replace(slot, child, childFitness);
+            }
+
+            continue;
+          }
+
+          const size_t slot = leastFitOf(selection);
+
+          std::lock_guard<std::mutex> lock(slotLocks[slot]);
+
+          // The slot may have been refilled since it was picked, so compare against its current occupant.
+          if (childFitness >= individuals[slot]->getFitness()) {
+            replace(slot, child, childFitness);
+          }
+        }
+      } catch (...) {
+        failed = true;
+        throw;
+      }
+    });
+
+    generation++;
+
+    return inserted.load();
+  }
+
+  void GeneticTrainer::mutateIndividuals(size_t begin) {
+    auto& individuals = population->getIndividuals();
+
+    if (begin >= individuals.size()) {
+      return;
+    }
+
+    // Every layer of every individual draws from its own keyed stream, so the result is identical for
+    // any number of threads.
+    const auto mutateRange = [&](size_t first, size_t last) {
+      for (size_t i = begin + first; i < begin + last; i++) {
+        mutateIndividual(*individuals[i], RandomKey{options.seed, generation, static_cast<uint32_t>(i)});
+      }
+    };
+
+    ThreadPool::global().parallelFor(individuals.size() - begin, 1, std::ref(mutateRange));
+  }
+
+  void GeneticTrainer::mutateIndividual(IIndividual& individual, const RandomKey& key) const {
+    uint32_t layerIndex = 0;
+
+    for (auto& layer : individual.getNeuralNetwork()) {
+      RandomStream weightRandom(key, layerIndex);
+      RandomStream biasRandom(key, layerIndex | RandomStream::BIAS_STREAM);
+
+      layer->mutateWeights(options.rate, 0.0f, options.intensity, weightRandom);
+      layer->mutateBiases(options.rate, 0.0f, options.intensity, biasRandom);
+
+      layerIndex++;
+    }
+  }
+
+  void GeneticTrainer::breed(const IIndividual& first, const IIndividual& second, IIndividual& child, const RandomKey& key) const {
+    const auto& firstNetwork = first.getNeuralNetwork();
+    const auto& secondNetwork = second.getNeuralNetwork();
+    auto& childNetwork = child.getNeuralNetwork();
+
+    if (firstNetwork.sizeLayers() != childNetwork.sizeLayers() || secondNetwork.sizeLayers() != childNetwork.sizeLayers()) {
+      throw exception::InvalidNetworkArchitectureException("Cannot cross over individuals with different structures");
+    }
+
+    size_t genomeSize = 0;
+
+    for (size_t l = 0; l < childNetwork.sizeLayers(); l++) {
+      const auto& childLayer = childNetwork.layer(l);
+      const auto& firstLayer = firstNetwork.layer(l);
+      const auto& secondLayer = secondNetwork.layer(l);
+
+      const bool sameShape = firstLayer.inputSize() == childLayer.inputSize() && firstLayer.outputSize() == childLayer.outputSize() &&
+                             secondLayer.inputSize() == childLayer.inputSize() && secondLayer.outputSize() == childLayer.outputSize() &&
+                             firstLayer.getBiases().size() == childLayer.getBiases().size() &&
+                             secondLayer.getBiases().size() == childLayer.getBiases().size();
+
+      if (!sameShape) {
+        throw exception::InvalidNetworkArchitectureException("Cannot cross over individuals with different structures");
+      }
+
+      genomeSize += childLayer.getWeights().rows() * childLayer.getWeights().cols() + childLayer.getBiases().size();
+    }
+
+    // The genome is every weight row followed by the biases, layer by layer.
+    RandomStream random(key, CROSSOVER_STREAM);
+    Crossover crossover(options.crossover, genomeSize, random);
+
+    for (size_t l = 0; l < childNetwork.sizeLayers(); l++) {
+      const auto& firstWeights = firstNetwork.layer(l).getWeights();
+      const auto& secondWeights = secondNetwork.layer(l).getWeights();
+      auto& childWeights = childNetwork.layer(l).getWeights();
+      auto& childBiases = childNetwork.layer(l).getBiases();
+
+      for (size_t row = 0; row < childWeights.rows(); row++) {
+        crossover.apply(firstWeights.data() + row * firstWeights.stride(), secondWeights.data() + row * secondWeights.stride(), childWeights.cols(),
+                        childWeights.data() + row * childWeights.stride());
+      }
+
+      crossover.apply(firstNetwork.layer(l).getBiases().data(), secondNetwork.layer(l).getBiases().data(), childBiases.size(), childBiases.data());
+    }
+
+    child.setFitness(0.0f);
   }
 
 }; // namespace neuro
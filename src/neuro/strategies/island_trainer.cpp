@@ -0,0 +1,153 @@
+#include "neuro/strategies/island_trainer.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+#include "neuro/utils/random.hpp"
+#include "neuro/utils/selection.hpp"
+#include "neuro/utils/thread_pool.hpp"
+#include "neuro/utils/version.hpp"
+
+namespace neuro {
+
+  namespace {
+
+    // Layer coordinate of the stream that picks Random migration targets.
+    constexpr uint32_t MIGRATION_STREAM = 0x7FFFFFFDu;
+
+  } // namespace
+
+  IslandTrainer::IslandTrainer(const std::vector<std::shared_ptr<Population>>& islands, const IslandOptions& options)
+    : islands(islands),
+      options(options) {
+    if (islands.empty()) {
+      throw exception::InvalidNetworkArchitectureException("An island trainer needs at least one island");
+    }
+
+    // Ring has one sender per inbox, the other topologies up to every other island.
+    const size_t senders = options.topology == MigrationTopology::Ring ? 1 : std::max<size_t>(islands.size() - 1, 1);
+
+    for (size_t i = 0; i < islands.size(); i++) {
+      if (islands[i] == nullptr) {
+        throw exception::InvalidNetworkArchitectureException("Island " + std::to_string(i) + " has no population");
+      }
+
+      GeneticOptions genetic = options.genetic;
+      genetic.seed = combineHash(options.genetic.seed, i);
+
+      trainers.push_back(std::make_unique<GeneticTrainer>(islands[i], genetic));
+      inboxes.push_back(std::make_unique<HandoffQueue<migrant_t>>(2 * senders * std::max<size_t>(options.migrants, 1)));
+    }
+  }
+
+  void IslandTrainer::run(size_t generations, const std::function<float(const INeuralNetwork&)>& evaluateFunction) {
+    ThreadPool::global().parallelFor(islands.size(), 1, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        evolveIsland(i, generations, evaluateFunction);
+      }
+    });
+
+    generation += static_cast<uint32_t>(generations);
+  }
+
+  const IIndividual& IslandTrainer::getBestIndividual() const {
+    const IIndividual* best = nullptr;
+
+    for (const auto& island : islands) {
+      if (island->empty()) {
+        continue;
+      }
+
+      const IIndividual& candidate = island->getBestIndividual();
+
+      if (best == nullptr || candidate.getFitness() > best->getFitness()) {
+        best = &candidate;
+      }
+    }
+
+    if (best == nullptr) {
+      throw exception::InvalidNetworkArchitectureException("Every island is empty");
+    }
+
+    return *best;
+  }
+
+  void IslandTrainer::evolveIsland(size_t island, size_t generations, const std::function<float(const INeuralNetwork&)>& evaluateFunction) {
+    auto& population = *islands[island];
+    const bool migrating = islands.size() > 1 && options.migrationInterval > 0 && options.migrants > 0;
+
+    for (size_t g = 0; g < generations; g++) {
+      const uint32_t epoch = generation + static_cast<uint32_t>(g);
+
+      population.evaluateFitness(evaluateFunction, options.evaluation);
+
+      if (migrating && (epoch + 1) % options.migrationInterval == 0) {
+        migrate(island, epoch);
+      }
+
+      trainers[island]->evolve();
+    }
+
+    population.evaluateFitness(evaluateFunction, options.evaluation);
+  }
+
+  void IslandTrainer::migrate(size_t island, uint32_t epoch) {
+    auto& population = *islands[island];
+    const size_t count = islands.size();
+
+    // Send first, so the migrants are this island's own fittest rather than fresh arrivals.
+    const auto fittest = population.topK(options.migrants);
+
+    if (options.topology == MigrationTopology::Ring) {
+      send(island, (island + 1) % count, fittest);
+    } else if (options.topology == MigrationTopology::FullyConnected) {
+      for (size_t target = 0; target < count; target++) {
+        if (target != island) {
+          send(island, target, fittest);
+        }
+      }
+    } else {
+      RandomStream random(RandomKey{options.genetic.seed, epoch, static_cast<uint32_t>(island)}, MIGRATION_STREAM);
+      send(island, (island + 1 + ((uint64_t(random()) * (count - 1)) >> 32)) % count, fittest);
+    }
+
+    std::vector<migrant_t> arrivals;
+    migrant_t migrant;
+
+    while (arrivals.size() < population.size() && inboxes[island]->tryPop(migrant)) {
+      arrivals.push_back(std::move(migrant));
+    }
+
+    if (arrivals.empty()) {
+      return;
+    }
+
+    // Arrivals take the places of the least fit, which selectTop leaves behind the survivors.
+    const auto fitness = population.getFitnesses();
+    const size_t survivors = population.size() - arrivals.size();
+    std::vector<size_t> ranking;
+
+    selectTop(fitness.data(), fitness.size(), survivors, ranking);
+
+    auto& individuals = population.getIndividuals();
+
+    for (size_t k = 0; k < arrivals.size(); k++) {
+      individuals[ranking[survivors + k]] = std::move(arrivals[k]);
+    }
+  }
+
+  void IslandTrainer::send(size_t island, size_t target, const std::vector<size_t>& fittest) {
+    for (size_t index : fittest) {
+      if (inboxes[target]->tryPush(islands[island]->get(index).clone())) {
+        sentCount.fetch_add(1, std::memory_order_relaxed);
+      } else {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+} // namespace neuro
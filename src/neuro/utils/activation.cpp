@@ -0,0 +1,55 @@
+#include "neuro/utils/activation.hpp"
+
+#include <cstddef>
+
+#include "internal/kernels.hpp"
+
+namespace neuro {
+
+  void ActivationFunction::apply(float* values, size_t size) const {
+    if (kind == ActivationKind::Custom) {
+      for (size_t i = 0; i < size; i++) {
+        values[i] = activate(values[i]);
+      }
+
+      return;
+    }
+
+    const auto& kernels = kernel::activeKernels();
+
+    switch (precision) {
+    case ActivationPrecision::Exact: kernels.activate(kind, values, size); break;
+    case ActivationPrecision::Fast: kernels.activateFast(kind, values, size); break;
+    case ActivationPrecision::Table: kernel::activateTable(kind, values, size); break;
+    }
+  }
+
+  const char* activationName(ActivationKind kind) {
+    switch (kind) {
+    case ActivationKind::Custom: return "custom";
+    case ActivationKind::Identity: return "identity";
+    case ActivationKind::Sigmoid: return "sigmoid";
+    case ActivationKind::Relu: return "relu";
+    case ActivationKind::Tanh: return "tanh";
+    case ActivationKind::LeakyRelu: return "leaky_relu";
+    case ActivationKind::Elu: return "elu";
+    case ActivationKind::Swish: return "swish";
+    case ActivationKind::Softplus: return "softplus";
+    case ActivationKind::HardSigmoid: return "hard_sigmoid";
+    }
+
+    return "custom";
+  }
+
+  bool isTranscendental(ActivationKind kind) {
+    switch (kind) {
+    case ActivationKind::Sigmoid:
+    case ActivationKind::Tanh:
+    case ActivationKind::Elu:
+    case ActivationKind::Swish:
+    case ActivationKind::Softplus: return true;
+    default: return false;
+    }
+  }
+
+} // namespace neuro
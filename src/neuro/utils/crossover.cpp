@@ -0,0 +1,121 @@
+#include "neuro/utils/crossover.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "internal/kernels.hpp"
+
+namespace neuro {
+
+  namespace {
+
+    // Parameters recombined per batch of random draws.
+    constexpr size_t CROSSOVER_CHUNK = 256;
+
+  } // namespace
+
+  Crossover::Crossover(const CrossoverOptions& options, size_t genomeSize, RandomStream& random)
+    : options(options),
+      random(random) {
+    if (options.kind == CrossoverKind::SinglePoint || options.kind == CrossoverKind::MultiPoint) {
+      cutCount = genomeSize < 2 ? 0 : options.kind == CrossoverKind::SinglePoint ? 1 : std::min(options.points, MAX_POINTS);
+
+      for (size_t i = 0; i < cutCount; i++) {
+        cuts[i] = 1 + static_cast<size_t>((uint64_t(random()) * (genomeSize - 1)) >> 32);
+      }
+
+      std::sort(cuts.begin(), cuts.begin() + cutCount);
+    } else if (options.kind == CrossoverKind::Blend) {
+      alpha = random.uniform();
+    }
+  }
+
+  void Crossover::apply(const float* first, const float* second, size_t size, float* child) {
+    switch (options.kind) {
+      case CrossoverKind::Uniform: applyUniform(first, second, size, child); break;
+      case CrossoverKind::SinglePoint:
+      case CrossoverKind::MultiPoint: applyPoints(first, second, size, child); break;
+      case CrossoverKind::Blend: kernel::activeKernels().blend(first, second, alpha, size, child); break;
+      case CrossoverKind::SimulatedBinary: applySimulatedBinary(first, second, size, child); break;
+    }
+
+    position += size;
+  }
+
+  void Crossover::applyUniform(const float* first, const float* second, size_t size, float* child) {
+    const auto select = kernel::activeKernels().select;
+    uint32_t raw[CROSSOVER_CHUNK / 32 + 1];
+    uint32_t mask[CROSSOVER_CHUNK / 32];
+
+    for (size_t offset = 0; offset < size; offset += CROSSOVER_CHUNK) {
+      const size_t count = std::min(CROSSOVER_CHUNK, size - offset);
+      const size_t words = count > carryBits ? (count - carryBits + 31) / 32 : 0;
+
+      random.fill(raw, words);
+      raw[words] = 0;
+
+      // The mask is the carried bits followed by the fresh words.
+      for (size_t i = 0; i < (count + 31) / 32; i++) {
+        const uint64_t combined = carry | (uint64_t(raw[i]) << carryBits);
+
+        mask[i] = static_cast<uint32_t>(combined);
+        carry = static_cast<uint32_t>(combined >> 32);
+      }
+
+      const size_t leftover = carryBits + 32 * words - count;
+
+      if (words == 0) {
+        carry = mask[0] >> count;
+      } else {
+        carry = leftover == 0 ? 0 : raw[words - 1] >> (32 - leftover);
+      }
+
+      carryBits = static_cast<uint32_t>(leftover);
+
+      select(first + offset, second + offset, mask, count, child + offset);
+    }
+  }
+
+  void Crossover::applyPoints(const float* first, const float* second, size_t size, float* child) {
+    const size_t end = position + size;
+
+    // Runs between cuts are plain copies; the parent flips at every cut passed.
+    for (size_t current = position; current < end;) {
+      while (nextCut < cutCount && cuts[nextCut] <= current) {
+        nextCut++;
+      }
+
+      const size_t runEnd = nextCut < cutCount ? std::min(cuts[nextCut], end) : end;
+      const float* source = nextCut % 2 == 0 ? first : second;
+
+      std::copy(source + (current - position), source + (runEnd - position), child + (current - position));
+      current = runEnd;
+    }
+  }
+
+  void Crossover::applySimulatedBinary(const float* first, const float* second, size_t size, float* child) {
+    const float exponent = 1.0f / (options.distributionIndex + 1.0f);
+    float spread[CROSSOVER_CHUNK];
+
+    for (size_t offset = 0; offset < size; offset += CROSSOVER_CHUNK) {
+      const size_t count = std::min(CROSSOVER_CHUNK, size - offset);
+
+      random.fillUniform(spread, count, 0.0f, 1.0f);
+
+      for (size_t i = 0; i < count; i++) {
+        const float u = spread[i];
+
+        spread[i] = u <= 0.5f ? std::pow(2.0f * u, exponent) : std::pow(1.0f / (2.0f * (1.0f - u)), exponent);
+      }
+
+      // Separate pass without branches or calls so it vectorizes.
+      for (size_t i = 0; i < count; i++) {
+        const float a = first[offset + i];
+        const float b = second[offset + i];
+
+        child[offset + i] = 0.5f * ((a + b) + spread[i] * (a - b));
+      }
+    }
+  }
+
+} // namespace neuro
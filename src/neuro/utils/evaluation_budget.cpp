@@ -0,0 +1,59 @@
+#include "neuro/utils/evaluation_budget.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace neuro {
+
+  void EvaluationToken::arm(std::chrono::nanoseconds timeLimit, size_t stepLimit, const CancellationSource* cancellation) {
+    hasDeadline = timeLimit.count() > 0;
+    deadline = hasDeadline ? clock_t::now() + timeLimit : clock_t::time_point{};
+    this->stepLimit = stepLimit;
+    stepCount = 0;
+    untilClock = CLOCK_INTERVAL;
+    source = cancellation;
+    state = EvaluationOutcome::Completed;
+  }
+
+  bool EvaluationToken::shouldStop() {
+    if (state == EvaluationOutcome::Completed && hasDeadline && clock_t::now() >= deadline) {
+      state = EvaluationOutcome::TimedOut;
+    }
+
+    if (state == EvaluationOutcome::Completed && source != nullptr && source->isCancelled()) {
+      state = EvaluationOutcome::Cancelled;
+    }
+
+    return state != EvaluationOutcome::Completed;
+  }
+
+  EvaluationOutcome EvaluationToken::finish() {
+    if (state == EvaluationOutcome::Completed && hasDeadline && clock_t::now() >= deadline) {
+      state = EvaluationOutcome::TimedOut;
+    }
+
+    return state;
+  }
+
+  void EvaluationCounters::record(EvaluationOutcome outcome, size_t count) {
+    switch (outcome) {
+      case EvaluationOutcome::Completed:
+        completed.fetch_add(count, std::memory_order_relaxed);
+        break;
+      case EvaluationOutcome::TimedOut:
+        timedOut.fetch_add(count, std::memory_order_relaxed);
+        break;
+      case EvaluationOutcome::Cancelled:
+        cancelled.fetch_add(count, std::memory_order_relaxed);
+        break;
+    }
+  }
+
+  void EvaluationCounters::reset() {
+    completed.store(0, std::memory_order_relaxed);
+    timedOut.store(0, std::memory_order_relaxed);
+    cancelled.store(0, std::memory_order_relaxed);
+  }
+
+} // namespace neuro
@@ -0,0 +1,71 @@
+#include "neuro/utils/evaluation_loop.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+#include "neuro/interfaces/i_population.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
+#include "neuro/utils/thread_pool.hpp"
+
+namespace neuro {
+
+  void runEvaluations(size_t count,
+                      size_t unit,
+                      const EvaluationOptions& options,
+                      const std::function<evaluation_worker_t()>& makeWorker,
+                      const std::function<void(size_t first, size_t size)>& penalize) {
+    auto& pool = ThreadPool::global();
+
+    unit = std::max<size_t>(unit, 1);
+
+    const size_t chunkSize = (std::max<size_t>(options.chunkSize, 1) + unit - 1) / unit * unit;
+    const size_t chunks = (count + chunkSize - 1) / chunkSize;
+    const size_t evaluators = std::min(options.threads == 0 ? pool.concurrency() : options.threads, chunks);
+
+    std::atomic<size_t> cursor{0};
+    std::atomic<bool> failed{false};
+
+    auto evaluate = [&](size_t, size_t) {
+      const auto worker = makeWorker();
+      EvaluationToken token;
+
+      try {
+        for (size_t begin = cursor.fetch_add(chunkSize); begin < count && !failed; begin = cursor.fetch_add(chunkSize)) {
+          const size_t end = std::min(begin + chunkSize, count);
+
+          for (size_t first = begin; first < end; first += unit) {
+            const size_t size = std::min(unit, end - first);
+            EvaluationOutcome outcome = EvaluationOutcome::Cancelled;
+
+            if (options.cancellation == nullptr || !options.cancellation->isCancelled()) {
+              token.arm(options.timeLimit, options.stepLimit, options.cancellation);
+              worker(first, size, token);
+              outcome = token.finish();
+            }
+
+            if (outcome != EvaluationOutcome::Completed) {
+              penalize(first, size);
+            }
+
+            if (options.counters != nullptr) {
+              options.counters->record(outcome, size);
+            }
+          }
+        }
+      } catch (...) {
+        failed = true;
+        throw;
+      }
+    };
+
+    if (evaluators <= 1) {
+      evaluate(0, 1);
+      return;
+    }
+
+    pool.parallelFor(evaluators, 1, evaluate);
+  }
+
+} // namespace neuro
@@ -0,0 +1,24 @@
+#include "neuro/utils/inference_workspace.hpp"
+
+namespace neuro {
+
+  InferenceWorkspace::InferenceWorkspace(size_t width) {
+    reserve(width);
+  }
+
+  void InferenceWorkspace::reserve(size_t width) {
+    if (width <= front.size()) {
+      return;
+    }
+
+    front.resize(width);
+    back.resize(width);
+  }
+
+  InferenceWorkspace& InferenceWorkspace::local() {
+    thread_local InferenceWorkspace workspace;
+
+    return workspace;
+  }
+
+} // namespace neuro
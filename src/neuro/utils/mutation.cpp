@@ -0,0 +1,72 @@
+#include "neuro/utils/mutation.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace neuro {
+
+  namespace {
+
+    constexpr size_t MUTATION_CHUNK = 256;
+
+    // Below this rate, jumping straight to the next selected parameter beats rolling every one of them.
+    constexpr float SPARSE_MUTATION_RATE = 0.25f;
+
+    // Draws the selection mask in bulk, then only as many normals as there are selected parameters.
+    void perturbDense(float* values, size_t size, float rate, float mean, float stddev, RandomStream& random) {
+      float chances[MUTATION_CHUNK];
+      float noise[MUTATION_CHUNK];
+
+      for (size_t offset = 0; offset < size; offset += MUTATION_CHUNK) {
+        const size_t count = std::min(MUTATION_CHUNK, size - offset);
+        size_t selected = 0;
+
+        random.fillUniform(chances, count, 0.0f, 1.0f);
+
+        for (size_t i = 0; i < count; i++) {
+          selected += chances[i] < rate;
+        }
+
+        random.fillNormal(noise, selected, mean, stddev);
+
+        for (size_t i = 0, next = 0; i < count; i++) {
+          if (chances[i] < rate) {
+            values[offset + i] += noise[next++];
+          }
+        }
+      }
+    }
+
+  } // namespace
+
+  // Selected positions form a Bernoulli process, so the gaps between them are geometric and can be drawn
+  // directly; the cost is proportional to rate * size instead of size.
+  void mutateParameters(float* values, size_t rows, size_t cols, size_t stride, float rate, float mean, float stddev, RandomStream& random) {
+    const size_t size = rows * cols;
+
+    if (rate <= 0.0f || size == 0) {
+      return;
+    }
+
+    if (rate >= SPARSE_MUTATION_RATE) {
+      for (size_t row = 0; row < rows; row++) {
+        perturbDense(values + row * stride, cols, rate, mean, stddev, random);
+      }
+
+      return;
+    }
+
+    const float scale = 1.0f / std::log1p(-rate);
+
+    const auto skip = [&]() -> size_t {
+      const float gap = std::floor(std::log(1.0f - random.uniform()) * scale);
+
+      return gap < static_cast<float>(size) ? static_cast<size_t>(gap) : size;
+    };
+
+    for (size_t position = skip(); position < size; position += 1 + skip()) {
+      values[(position / cols) * stride + position % cols] += random.normal(mean, stddev);
+    }
+  }
+
+} // namespace neuro
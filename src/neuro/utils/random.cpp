@@ -0,0 +1,180 @@
+#include "neuro/utils/random.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+
+#include "internal/kernels.hpp"
+
+namespace neuro {
+
+  namespace {
+
+    std::atomic<uint64_t> seed{(uint64_t(std::random_device{}()) << 32) | std::random_device{}()};
+    std::atomic<uint32_t> seedEpoch{0};
+    std::atomic<uint32_t> threadCount{0};
+
+    // Generation coordinate reserved for thread-local streams so they never collide with keyed ones.
+    constexpr uint32_t LOCAL_GENERATION = 0xFFFFFFFFu;
+
+    // Bulk draws work through a stack buffer of this many 32-bit values.
+    constexpr size_t FILL_CHUNK = 256;
+
+    FORCE_INLINE float toUnit(uint32_t bits) {
+      return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+    }
+
+    FORCE_INLINE void multiply(uint32_t a, uint32_t b, uint32_t& high, uint32_t& low) {
+      const uint64_t product = uint64_t(a) * b;
+
+      high = static_cast<uint32_t>(product >> 32);
+      low = static_cast<uint32_t>(product);
+    }
+
+  } // namespace
+
+  RandomStream::RandomStream(uint64_t seed, uint32_t generation, uint32_t individual, uint32_t layer)
+    : counter{0, layer, individual, generation},
+      key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)} {}
+
+  RandomStream::RandomStream(const RandomKey& key, uint32_t layer)
+    : RandomStream(key.seed, key.generation, key.individual, layer) {}
+
+  float RandomStream::normal(float mean, float stddev) {
+    if (hasSpareNormal) {
+      hasSpareNormal = false;
+      return mean + stddev * spareNormal;
+    }
+
+    // Box-Muller; 1 - uniform() lies in (0, 1] so the logarithm stays finite.
+    const float radius = std::sqrt(-2.0f * std::log(1.0f - uniform()));
+    const float angle = 6.28318530717958647f * uniform();
+
+    spareNormal = radius * std::sin(angle);
+    hasSpareNormal = true;
+
+    return mean + stddev * radius * std::cos(angle);
+  }
+
+  void RandomStream::fill(uint32_t* output, size_t size) {
+    size_t written = 0;
+
+    while (position < 4 && written < size) {
+      output[written++] = block[position++];
+    }
+
+    const size_t blocks = (size - written) / 4;
+
+    if (blocks > 0) {
+      kernel::activeKernels().philox(counter.data(), key.data(), blocks, output + written);
+      counter[0] += static_cast<uint32_t>(blocks);
+      written += blocks * 4;
+    }
+
+    while (written < size) {
+      output[written++] = (*this)();
+    }
+  }
+
+  void RandomStream::fillUniform(float* output, size_t size, float min, float max) {
+    uint32_t bits[FILL_CHUNK];
+
+    for (size_t offset = 0; offset < size; offset += FILL_CHUNK) {
+      const size_t count = std::min(FILL_CHUNK, size - offset);
+
+      fill(bits, count);
+
+      for (size_t i = 0; i < count; i++) {
+        output[offset + i] = min + (max - min) * toUnit(bits[i]);
+      }
+    }
+  }
+
+  void RandomStream::fillNormal(float* output, size_t size, float mean, float stddev) {
+    uint32_t bits[FILL_CHUNK];
+    size_t written = 0;
+
+    if (hasSpareNormal && size > 0) {
+      hasSpareNormal = false;
+      output[written++] = mean + stddev * spareNormal;
+    }
+
+    // Batches draw one pair of uniforms per missing pair of values, never more. Rejected pairs are topped
+    // up by the next batch, so the final stream position depends on the values drawn as well as on size;
+    // it is still a pure function of the stream, which is all reproducibility needs.
+    while (written < size) {
+      const size_t pairs = std::min((size - written + 1) / 2, FILL_CHUNK / 2);
+
+      fill(bits, pairs * 2);
+
+      for (size_t i = 0; i < pairs && written < size; i++) {
+        const float u = 2.0f * toUnit(bits[2 * i]) - 1.0f;
+        const float v = 2.0f * toUnit(bits[2 * i + 1]) - 1.0f;
+        const float s = u * u + v * v;
+
+        if (s >= 1.0f || s == 0.0f) {
+          continue;
+        }
+
+        const float factor = std::sqrt(-2.0f * std::log(s) / s);
+
+        output[written++] = mean + stddev * u * factor;
+
+        if (written < size) {
+          output[written++] = mean + stddev * v * factor;
+        } else {
+          spareNormal = v * factor;
+          hasSpareNormal = true;
+        }
+      }
+    }
+  }
+
+  std::array<uint32_t, 4> RandomStream::philox(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+    for (int round = 0; round < 10; round++) {
+      uint32_t high0, low0, high1, low1;
+
+      multiply(0xD2511F53u, counter[0], high0, low0);
+      multiply(0xCD9E8D57u, counter[2], high1, low1);
+
+      counter = {high1 ^ counter[1] ^ key[0], low1, high0 ^ counter[3] ^ key[1], low0};
+
+      key[0] += 0x9E3779B9u;
+      key[1] += 0xBB67AE85u;
+    }
+
+    return counter;
+  }
+
+  RandomStream& RandomStream::local() {
+    thread_local const uint32_t ordinal = threadCount.fetch_add(1);
+    thread_local uint32_t epoch = seedEpoch.load();
+    thread_local RandomStream stream(globalSeed(), LOCAL_GENERATION, ordinal, 0);
+
+    const uint32_t current = seedEpoch.load(std::memory_order_acquire);
+
+    if (epoch != current) {
+      epoch = current;
+      stream = RandomStream(globalSeed(), LOCAL_GENERATION, ordinal, 0);
+    }
+
+    return stream;
+  }
+
+  void RandomStream::refill() {
+    block = philox(counter, key);
+    counter[0]++;
+    position = 0;
+  }
+
+  uint64_t globalSeed() {
+    return seed.load(std::memory_order_acquire);
+  }
+
+  void setGlobalSeed(uint64_t value) {
+    seed.store(value, std::memory_order_release);
+    seedEpoch.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+} // namespace neuro
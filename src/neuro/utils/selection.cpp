@@ -0,0 +1,149 @@
+#include "neuro/utils/selection.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "neuro/utils/evaluation_budget.hpp"
+
+namespace neuro {
+
+  namespace {
+
+    FORCE_INLINE bool fitter(const float* fitness, size_t a, size_t b) {
+      return fitness[a] > fitness[b] || (fitness[a] == fitness[b] && a < b);
+    }
+
+  } // namespace
+
+  void selectTop(const float* fitness, size_t size, size_t k, std::vector<size_t>& indices) {
+    indices.resize(size);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    k = std::min(k, size);
+
+    const auto compare = [&](size_t a, size_t b) { return fitter(fitness, a, b); };
+
+    if (k < size) {
+      std::nth_element(indices.begin(), indices.begin() + k, indices.end(), compare);
+    }
+
+    std::sort(indices.begin(), indices.begin() + k, compare);
+  }
+
+  std::vector<size_t> topK(const std::vector<float>& fitness, size_t k) {
+    std::vector<size_t> indices;
+    selectTop(fitness.data(), fitness.size(), k, indices);
+    indices.resize(std::min(k, fitness.size()));
+
+    return indices;
+  }
+
+  size_t tournamentSelect(const float* fitness, size_t size, size_t tournament, RandomStream& random) {
+    size_t best = (uint64_t(random()) * size) >> 32;
+
+    for (size_t t = 1; t < tournament; t++) {
+      const size_t contestant = (uint64_t(random()) * size) >> 32;
+
+      if (fitter(fitness, contestant, best)) {
+        best = contestant;
+      }
+    }
+
+    return best;
+  }
+
+  AliasTable::AliasTable(const std::vector<float>& weights) {
+    build(weights.data(), weights.size());
+  }
+
+  void AliasTable::build(const float* weights, size_t size) {
+    probability.resize(size);
+    alias.resize(size);
+    small.clear();
+    large.clear();
+
+    double total = 0.0;
+
+    for (size_t i = 0; i < size; i++) {
+      total += weights[i];
+    }
+
+    if (!(total > 0.0) || !std::isfinite(total)) {
+      std::fill(probability.begin(), probability.end(), 1.0f);
+      std::iota(alias.begin(), alias.end(), 0u);
+      return;
+    }
+
+    const double scale = static_cast<double>(size) / total;
+
+    for (size_t i = 0; i < size; i++) {
+      probability[i] = static_cast<float>(weights[i] * scale);
+      alias[i] = static_cast<uint32_t>(i);
+      (probability[i] < 1.0f ? small : large).push_back(static_cast<uint32_t>(i));
+    }
+
+    while (!small.empty() && !large.empty()) {
+      const uint32_t less = small.back();
+      const uint32_t more = large.back();
+      small.pop_back();
+
+      alias[less] = more;
+      probability[more] -= 1.0f - probability[less];
+
+      if (probability[more] < 1.0f) {
+        large.pop_back();
+        small.push_back(more);
+      }
+    }
+
+    // Whatever is left only differs from 1 by rounding.
+    for (uint32_t i : small) {
+      probability[i] = 1.0f;
+    }
+
+    for (uint32_t i : large) {
+      probability[i] = 1.0f;
+    }
+  }
+
+  void Selector::prepare(SelectionKind kind, const float* fitness, size_t size, size_t tournamentSize, float rankPressure) {
+    this->kind = kind;
+    this->tournament = std::max<size_t>(tournamentSize, 1);
+    this->fitness = fitness;
+    this->count = size;
+
+    if (kind == SelectionKind::Tournament) {
+      return;
+    }
+
+    weights.resize(size);
+
+    if (kind == SelectionKind::Roulette) {
+      const auto drawable = [&](size_t i) { return std::isfinite(fitness[i]) && fitness[i] > TIMEOUT_FITNESS; };
+      float lowest = std::numeric_limits<float>::max();
+
+      for (size_t i = 0; i < size; i++) {
+        if (drawable(i)) {
+          lowest = std::min(lowest, fitness[i]);
+        }
+      }
+
+      for (size_t i = 0; i < size; i++) {
+        weights[i] = drawable(i) ? fitness[i] - lowest : 0.0f;
+      }
+    } else {
+      const float pressure = std::clamp(rankPressure, 1.0f, 2.0f);
+
+      selectTop(fitness, size, size, order);
+
+      for (size_t r = 0; r < size; r++) {
+        weights[order[r]] = size < 2 ? 1.0f : pressure - 2.0f * (pressure - 1.0f) * static_cast<float>(r) / static_cast<float>(size - 1);
+      }
+    }
+
+    table.build(weights.data(), size);
+  }
+
+} // namespace neuro
@@ -0,0 +1,122 @@
+#include "neuro/utils/simd.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include "internal/attribute.hpp"
+#include "internal/kernels.hpp"
+
+#if defined(NEURO_ARCH_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace neuro {
+
+  namespace {
+
+    SimdLevel detectLevel() {
+#if defined(NEURO_ARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+      __builtin_cpu_init();
+
+      if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+      }
+      if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdLevel::AVX2;
+      }
+      if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+      }
+#elif defined(NEURO_ARCH_X86) && defined(_MSC_VER)
+      int info[4];
+
+      __cpuid(info, 0);
+      const int maxLeaf = info[0];
+
+      __cpuid(info, 1);
+      const bool sse2 = info[3] & (1 << 26);
+      const bool fma = info[2] & (1 << 12);
+      const bool osxsave = info[2] & (1 << 27);
+      const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+
+      bool avx2 = false;
+      bool avx512 = false;
+
+      if (maxLeaf >= 7) {
+        __cpuidex(info, 7, 0);
+        avx2 = info[1] & (1 << 5);
+        avx512 = info[1] & (1 << 16);
+      }
+
+      if (avx512 && (xcr0 & 0xE6) == 0xE6) {
+        return SimdLevel::AVX512;
+      }
+      if (avx2 && fma && (xcr0 & 0x6) == 0x6) {
+        return SimdLevel::AVX2;
+      }
+      if (sse2) {
+        return SimdLevel::SSE2;
+      }
+#endif
+      return SimdLevel::Scalar;
+    }
+
+    // Function-local statics, so kernels used while other translation units are still being statically
+    // initialised (a global network with random weights) find them ready.
+    SimdLevel detectedLevel() {
+      static const SimdLevel level = detectLevel();
+
+      return level;
+    }
+
+    std::atomic<const kernel::KernelTable*>& activeTable() {
+      static std::atomic<const kernel::KernelTable*> table{&kernel::kernelTable(detectedLevel())};
+
+      return table;
+    }
+
+  } // namespace
+
+  namespace kernel {
+
+    const KernelTable& kernelTable(SimdLevel level) {
+      static const KernelTable scalar{SimdLevel::Scalar, gemvScalar, gemmScalar, activateScalar, activateFastScalar, philoxScalar, selectScalar, blendScalar, laneGemvScalar};
+
+#ifdef NEURO_ARCH_X86
+      static const KernelTable sse2{SimdLevel::SSE2, gemvSse2, gemmSse2, activateSse2, activateFastSse2, philoxScalar, selectSse2, blendSse2, laneGemvSse2};
+      static const KernelTable avx2{SimdLevel::AVX2, gemvAvx2, gemmAvx2, activateAvx2, activateFastAvx2, philoxAvx2, selectAvx2, blendAvx2, laneGemvAvx2};
+      static const KernelTable avx512{SimdLevel::AVX512, gemvAvx512, gemmAvx512, activateAvx512, activateFastAvx512, philoxAvx512, selectAvx512, blendAvx512, laneGemvAvx512};
+
+      switch (level) {
+      case SimdLevel::AVX512: return avx512;
+      case SimdLevel::AVX2: return avx2;
+      case SimdLevel::SSE2: return sse2;
+      case SimdLevel::Scalar: break;
+      }
+#else
+      (void)level;
+#endif
+
+      return scalar;
+    }
+
+    const KernelTable& activeKernels() {
+      return *activeTable().load(std::memory_order_relaxed);
+    }
+
+  } // namespace kernel
+
+  SimdLevel detectSimdLevel() {
+    return detectedLevel();
+  }
+
+  SimdLevel getSimdLevel() {
+    return kernel::activeKernels().level;
+  }
+
+  void setSimdLevel(SimdLevel level) {
+    activeTable().store(&kernel::kernelTable(std::min(level, detectedLevel())), std::memory_order_relaxed);
+  }
+
+} // namespace neuro
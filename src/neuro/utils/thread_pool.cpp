@@ -0,0 +1,261 @@
+#include "neuro/utils/thread_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace neuro {
+
+  struct ThreadPool::Job {
+    const std::function<void(size_t, size_t)>& body;
+    size_t grain;
+    size_t leaf;
+    std::atomic<size_t> remaining;
+    std::mutex mutex{};
+    std::condition_variable done{};
+    std::exception_ptr failure{};
+  };
+
+  namespace {
+
+    // Initial ring size; halving splits push about log2(count) tasks per range, so this rarely grows.
+    constexpr size_t QUEUE_CAPACITY = 64;
+
+    thread_local const ThreadPool* currentPool = nullptr;
+    thread_local size_t currentIndex = 0;
+
+    size_t roundUp(size_t value, size_t multiple) {
+      return (value + multiple - 1) / multiple * multiple;
+    }
+
+    std::unique_ptr<ThreadPool>& globalPool() {
+      static std::unique_ptr<ThreadPool> pool = std::make_unique<ThreadPool>(ThreadPoolOptions{});
+
+      return pool;
+    }
+
+  } // namespace
+
+  ThreadPool::ThreadPool(size_t workers)
+    : ThreadPool(ThreadPoolOptions{workers, false}) {}
+
+  ThreadPool::ThreadPool(const ThreadPoolOptions& options) {
+    // One queue per worker plus a shared one for threads outside the pool.
+    for (size_t i = 0; i <= options.workers; i++) {
+      queues.push_back(std::make_unique<Queue>());
+      queues.back()->tasks.slots.resize(QUEUE_CAPACITY);
+    }
+
+    workers.reserve(options.workers);
+
+    for (size_t i = 0; i < options.workers; i++) {
+      workers.emplace_back([this, i, pin = options.pinThreads] { work(i, pin); });
+    }
+  }
+
+  ThreadPool::~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex);
+      stopping = true;
+    }
+
+    available.notify_all();
+
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+
+  void ThreadPool::parallelFor(size_t count, size_t grain, const std::function<void(size_t begin, size_t end)>& body) {
+    grain = std::max<size_t>(grain, 1);
+
+    if (count == 0) {
+      return;
+    }
+
+    if (workers.empty() || count <= grain) {
+      body(0, count);
+      return;
+    }
+
+    // Roughly four leaves per thread leaves room for stealing without drowning the queues.
+    const size_t leaf = std::max(grain, roundUp((count + 4 * concurrency() - 1) / (4 * concurrency()), grain));
+    const size_t queue = currentQueue();
+
+    Job job{body, grain, leaf, {count}};
+
+    execute(queue, Task{&job, 0, count});
+
+    while (job.remaining.load(std::memory_order_acquire) != 0) {
+      if (!runOne(queue)) {
+        std::unique_lock<std::mutex> lock(job.mutex);
+        job.done.wait_for(lock, std::chrono::microseconds(100), [&] { return job.remaining.load(std::memory_order_acquire) == 0; });
+      }
+    }
+
+    // Completers notify while holding the lock, so taking it once more guarantees none still touches job.
+    std::lock_guard<std::mutex> lock(job.mutex);
+
+    if (job.failure) {
+      std::rethrow_exception(job.failure);
+    }
+  }
+
+  ThreadPool& ThreadPool::global() {
+    return *globalPool();
+  }
+
+  void ThreadPool::configureGlobal(const ThreadPoolOptions& options) {
+    auto& pool = globalPool();
+
+    pool.reset();
+    pool = std::make_unique<ThreadPool>(options);
+  }
+
+  size_t ThreadPool::currentQueue() const {
+    return currentPool == this ? currentIndex : workers.size();
+  }
+
+  void ThreadPool::TaskRing::push_back(const Task& task) {
+    if (count == slots.size()) {
+      std::vector<Task> grown(std::max<size_t>(2 * slots.size(), QUEUE_CAPACITY));
+
+      for (size_t i = 0; i < count; i++) {
+        grown[i] = slots[(head + i) % slots.size()];
+      }
+
+      slots.swap(grown);
+      head = 0;
+    }
+
+    slots[(head + count) % slots.size()] = task;
+    count++;
+  }
+
+  void ThreadPool::push(size_t queue, const Task& task) {
+    {
+      std::lock_guard<std::mutex> lock(queues[queue]->mutex);
+      queues[queue]->tasks.push_back(task);
+      queued.fetch_add(1, std::memory_order_release);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+
+    available.notify_one();
+  }
+
+  bool ThreadPool::tryPop(size_t queue, Task& task) {
+    std::lock_guard<std::mutex> lock(queues[queue]->mutex);
+    auto& tasks = queues[queue]->tasks;
+
+    if (tasks.empty()) {
+      return false;
+    }
+
+    task = tasks.back();
+    tasks.pop_back();
+    queued.fetch_sub(1, std::memory_order_relaxed);
+
+    return true;
+  }
+
+  bool ThreadPool::trySteal(size_t thief, Task& task) {
+    for (size_t offset = 1; offset < queues.size(); offset++) {
+      auto& victim = *queues[(thief + offset) % queues.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+
+      if (!victim.tasks.empty()) {
+        task = victim.tasks.front();
+        victim.tasks.pop_front();
+        queued.fetch_sub(1, std::memory_order_relaxed);
+
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  bool ThreadPool::runOne(size_t queue) {
+    Task task;
+
+    if (!tryPop(queue, task) && !trySteal(queue, task)) {
+      return false;
+    }
+
+    execute(queue, task);
+
+    return true;
+  }
+
+  void ThreadPool::execute(size_t queue, Task task) {
+    Job& job = *task.job;
+
+    while (task.end - task.begin > job.leaf) {
+      const size_t middle = task.begin + roundUp((task.end - task.begin) / 2, job.grain);
+
+      if (middle >= task.end) {
+        break;
+      }
+
+      push(queue, Task{&job, middle, task.end});
+      task.end = middle;
+    }
+
+    try {
+      job.body(task.begin, task.end);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(job.mutex);
+
+      if (!job.failure) {
+        job.failure = std::current_exception();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(job.mutex);
+
+    if (job.remaining.fetch_sub(task.end - task.begin, std::memory_order_acq_rel) == task.end - task.begin) {
+      job.done.notify_all();
+    }
+  }
+
+  void ThreadPool::work(size_t index, bool pin) {
+    currentPool = this;
+    currentIndex = index;
+
+#if defined(__linux__)
+    if (pin) {
+      const unsigned cores = std::max(std::thread::hardware_concurrency(), 1u);
+      cpu_set_t set;
+
+      CPU_ZERO(&set);
+      CPU_SET((index + 1) % cores, &set);
+      pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#else
+    (void)pin;
+#endif
+
+    while (true) {
+      if (runOne(index)) {
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(sleepMutex);
+      available.wait(lock, [this] { return stopping || queued.load(std::memory_order_acquire) > 0; });
+
+      if (stopping && queued.load(std::memory_order_acquire) == 0) {
+        return;
+      }
+    }
+  }
+
+} // namespace neuro
@@ -0,0 +1,28 @@
+#include "neuro/utils/version.hpp"
+
+#include <atomic>
+
+namespace neuro {
+
+  namespace {
+
+    // Threads reserve stamps in blocks so parallel mutation does not contend on one counter.
+    constexpr uint64_t VERSION_BLOCK = uint64_t(1) << 16;
+
+    std::atomic<uint64_t> nextBlock{1};
+
+  } // namespace
+
+  uint64_t nextVersion() {
+    thread_local uint64_t current = 0;
+    thread_local uint64_t end = 0;
+
+    if (current == end) {
+      current = nextBlock.fetch_add(VERSION_BLOCK, std::memory_order_relaxed);
+      end = current + VERSION_BLOCK;
+    }
+
+    return current++;
+  }
+
+} // namespace neuro
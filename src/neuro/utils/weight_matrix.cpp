@@ -0,0 +1,88 @@
+#include "neuro/utils/weight_matrix.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+
+namespace neuro {
+
+  WeightMatrix::WeightMatrix(size_t rows, size_t cols) {
+    reshape(rows, cols);
+  }
+
+  WeightMatrix::WeightMatrix(std::initializer_list<std::initializer_list<float>> rows) {
+    reshape(rows.size(), rows.size() == 0 ? 0 : rows.begin()->size());
+
+    size_t i = 0;
+
+    for (const auto& row : rows) {
+      if (row.size() != colCount) {
+        throw exception::InvalidNetworkArchitectureException("Weight matrix rows must all have the same number of columns");
+      }
+
+      std::copy(row.begin(), row.end(), values.data() + i * rowStride);
+      i++;
+    }
+  }
+
+  WeightMatrix::WeightMatrix(const std::vector<std::vector<float>>& rows) {
+    reshape(rows.size(), rows.empty() ? 0 : rows[0].size());
+
+    for (size_t i = 0; i < rows.size(); i++) {
+      if (rows[i].size() != colCount) {
+        throw exception::InvalidNetworkArchitectureException("Weight matrix rows must all have the same number of columns");
+      }
+
+      std::copy(rows[i].begin(), rows[i].end(), values.data() + i * rowStride);
+    }
+  }
+
+  void WeightMatrix::reshape(size_t rows, size_t cols) {
+    rowCount = rows;
+    colCount = cols;
+    rowStride = alignedStride(cols);
+
+    values.assign(rowCount * rowStride, 0.0f);
+  }
+
+  void WeightMatrix::fill(float value) {
+    for (size_t i = 0; i < rowCount; i++) {
+      std::fill_n(values.data() + i * rowStride, colCount, value);
+    }
+  }
+
+  std::vector<std::vector<float>> WeightMatrix::toVector() const {
+    std::vector<std::vector<float>> rows(rowCount);
+
+    for (size_t i = 0; i < rowCount; i++) {
+      const float* row = values.data() + i * rowStride;
+
+      rows[i].assign(row, row + colCount);
+    }
+
+    return rows;
+  }
+
+  bool WeightMatrix::operator==(const WeightMatrix& other) const {
+    if (rowCount != other.rowCount || colCount != other.colCount) {
+      return false;
+    }
+
+    for (size_t i = 0; i < rowCount; i++) {
+      const float* row = values.data() + i * rowStride;
+
+      if (!std::equal(row, row + colCount, other.values.data() + i * other.rowStride)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  size_t WeightMatrix::alignedStride(size_t cols) {
+    return (cols + STRIDE_ALIGNMENT - 1) / STRIDE_ALIGNMENT * STRIDE_ALIGNMENT;
+  }
+
+} // namespace neuro
@@ -86,4 +86,99 @@ TEST_CASE("DenseLayer - Object construction tests") {
   }
 }
 
+TEST_CASE("DenseLayer - Row-parallel feedforward matches the single-threaded path") {
+  neuro::DenseLayer layer(37, 203, neuro::maker::activationTanh_fn());
+
+  layer.randomizeWeights(-1.0f, 1.0f);
+  layer.randomizeBiases(-1.0f, 1.0f);
+
+  neuro::neuro_layer_t inputs(37);
+
+  for (size_t i = 0; i < inputs.size(); i++) {
+    inputs[i] = static_cast<float>(i) * 0.05f - 0.9f;
+  }
+
+  CHECK(layer.getParallelThreshold() == 0);
+
+  const auto expected = layer.feedforward(inputs);
+
+  layer.setParallelThreshold(1);
+
+  CHECK(layer.feedforward(inputs) == expected);
+
+  neuro::neuro_layer_t outputs(203);
+  layer.feedforward(inputs.data(), outputs.data());
+
+  CHECK(outputs == expected);
+}
+
+TEST_CASE("DenseLayer - Keyed mutation only touches the selected parameters") {
+  neuro::DenseLayer layer(300, 20, neuro::maker::activationTanh_fn());
+  neuro::RandomStream random(11, 0, 0, 0);
+
+  layer.randomizeWeights(-1.0f, 1.0f, random);
+  const auto original = layer.getWeights();
+
+  layer.mutateWeights(0.0f, 0.0f, 1.0f, random);
+
+  CHECK(layer.getWeights() == original);
+
+  layer.mutateWeights(0.1f, 0.0f, 1.0f, random);
+
+  size_t changed = 0;
+
+  for (size_t i = 0; i < layer.outputSize(); i++) {
+    for (size_t j = 0; j < layer.inputSize(); j++) {
+      changed += layer.getWeight(i, j) != original.row(i)[j];
+    }
+  }
+
+  CHECK(changed > 450);
+  CHECK(changed < 750);
+
+  neuro::DenseLayer copy(original, layer.getBiases(), neuro::maker::activationTanh_fn());
+  neuro::RandomStream replay(11, 0, 0, 0);
+
+  copy.randomizeWeights(-1.0f, 1.0f, replay);
+  copy.mutateWeights(0.0f, 0.0f, 1.0f, replay);
+  copy.mutateWeights(0.1f, 0.0f, 1.0f, replay);
+
+  CHECK(copy.getWeights() == layer.getWeights());
+}
+
+TEST_CASE("DenseLayer - Sparse mutation selects about rate * parameters") {
+  neuro::DenseLayer layer(1000, 200);
+  neuro::RandomStream random(21, 0, 0, 0);
+
+  layer.mutateWeights(0.005f, 0.0f, 1.0f, random);
+
+  size_t changed = 0;
+  bool inBounds = true;
+
+  for (size_t i = 0; i < layer.outputSize(); i++) {
+    for (size_t j = 0; j < layer.inputSize(); j++) {
+      changed += layer.getWeight(i, j) != 0.0f;
+    }
+
+    // Padding past the logical columns must never be touched.
+    for (size_t j = layer.inputSize(); j < layer.getWeights().stride(); j++) {
+      inBounds = inBounds && layer.getWeights().data()[i * layer.getWeights().stride() + j] == 0.0f;
+    }
+  }
+
+  CHECK(inBounds);
+  CHECK(changed > 850);
+  CHECK(changed < 1150);
+
+  layer.mutateBiases(0.01f, 0.0f, 1.0f, random);
+
+  size_t changedBiases = 0;
+
+  for (float bias : layer.getBiases()) {
+    changedBiases += bias != 0.0f;
+  }
+
+  CHECK(changedBiases < 12);
+}
+
 TEST_IMPL_ILAYER("DenseLayer", neuro::DenseLayer);
@@ -2,12 +2,65 @@
 
 #include <doctest/doctest.h>
 
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
+#include <new>
+#include <vector>
 
 #include "interfaces/i_neural_network_test.hpp"
 #include "neuro/impl/dense_layer.hpp"
 #include "neuro/interfaces/i_layer.hpp"
 #include "neuro/makers/activation.hpp"
+#include "neuro/utils/simd.hpp"
+
+// Counts allocations on every thread, so work handed to the pool workers is covered too.
+std::atomic<size_t> allocationCount{0};
+
+void* operator new(size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+  if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+
+  throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+  const size_t align = static_cast<size_t>(alignment);
+  void* raw = std::malloc(size + align + sizeof(void*));
+
+  if (raw == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  auto aligned = (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + align - 1) & ~static_cast<std::uintptr_t>(align - 1);
+  reinterpret_cast<void**>(aligned)[-1] = raw;
+
+  return reinterpret_cast<void*>(aligned);
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+  if (pointer != nullptr) {
+    std::free(static_cast<void**>(pointer)[-1]);
+  }
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t alignment) noexcept {
+  operator delete(pointer, alignment);
+}
 
 template <class... Args>
 std::unique_ptr<neuro::ILayer> neuralNetworkFactory(Args&&... args) {
@@ -142,4 +195,165 @@ TEST_CASE("NeuralNetwork - Object construction tests") {
   }
 }
 
+TEST_CASE("NeuralNetwork - Allocation-free inference into caller buffers") {
+  neuro::NeuralNetwork network({3, 16, 8, 2}, neuro::maker::activationSigmoid());
+
+  network.randomizeWeights(-1.0f, 1.0f);
+  network.randomizeBiases(-1.0f, 1.0f);
+
+  neuro::neuro_layer_t input = {0.5f, -0.25f, 1.0f};
+  neuro::neuro_layer_t output(network.outputSize());
+
+  const auto expected = network.feedforward(input);
+
+  SUBCASE("Thread-local workspace") {
+    network.feedforward(input, output);
+
+    const size_t before = allocationCount;
+
+    for (int i = 0; i < 100; i++) {
+      network.feedforward(input, output);
+    }
+
+    CHECK(allocationCount == before);
+    CHECK(output == expected);
+
+    network.feedforward(input);
+
+    CHECK(allocationCount > before);
+  }
+
+  SUBCASE("Caller-owned workspace") {
+    neuro::InferenceWorkspace workspace(network.maxLayerWidth());
+
+    const size_t before = allocationCount;
+
+    for (int i = 0; i < 100; i++) {
+      network.feedforward(input, output, workspace);
+    }
+
+    CHECK(allocationCount == before);
+    CHECK(output == expected);
+    CHECK(workspace.capacity() == 16);
+  }
+
+  SUBCASE("Buffer sizes are validated") {
+    neuro::neuro_layer_t wrongOutput(network.outputSize() + 1);
+    neuro::neuro_layer_t wrongInput(network.inputSize() + 1);
+
+    CHECK_THROWS_AS(network.feedforward(input, wrongOutput), neuro::exception::InvalidNetworkArchitectureException);
+    CHECK_THROWS_AS(network.feedforward(wrongInput, output), neuro::exception::InvalidNetworkArchitectureException);
+  }
+}
+
+TEST_CASE("NeuralNetwork - Compiled inference plan") {
+  std::vector<neuro::ActivationFunction> activations = {
+    neuro::maker::activationRelu(),
+    neuro::maker::activation(neuro::ActivationKind::Tanh, neuro::ActivationPrecision::Fast),
+    neuro::ActivationFunction{[](float x) { return x * 0.5f; }, [](float) { return 0.5f; }},
+  };
+
+  neuro::NeuralNetwork network({5, 19, 7, 3}, activations);
+
+  network.randomizeWeights(-1.0f, 1.0f);
+  network.randomizeBiases(-1.0f, 1.0f);
+
+  neuro::neuro_layer_t input = {0.5f, -0.25f, 1.0f, 0.75f, -2.0f};
+  const auto expected = network.feedforward(input);
+
+  auto compiled = network.compile();
+
+  CHECK(compiled.inputSize() == 5);
+  CHECK(compiled.outputSize() == 3);
+  CHECK(compiled.sizeLayers() == 3);
+  CHECK(compiled.level() == neuro::getSimdLevel());
+
+  SUBCASE("Outputs match the source network and survive later changes to it") {
+    auto outputs = compiled.feedforward(input);
+
+    for (size_t i = 0; i < outputs.size(); i++) {
+      CHECK(outputs[i] == doctest::Approx(expected[i]).epsilon(1e-5));
+    }
+
+    network.randomizeWeights(-1.0f, 1.0f);
+
+    CHECK(compiled.feedforward(input) == outputs);
+  }
+
+  SUBCASE("Inference does not allocate") {
+    neuro::neuro_layer_t output(compiled.outputSize());
+    neuro::InferenceWorkspace workspace(compiled.maxLayerWidth());
+
+    const size_t before = allocationCount;
+
+    for (int i = 0; i < 100; i++) {
+      compiled.feedforward(input, output);
+      compiled.feedforward(input, output, workspace);
+    }
+
+    CHECK(allocationCount == before);
+  }
+
+  SUBCASE("Invalid networks and buffers are rejected") {
+    neuro::neuro_layer_t wrongInput(compiled.inputSize() + 1);
+    neuro::neuro_layer_t output(compiled.outputSize());
+
+    CHECK_THROWS_AS(compiled.feedforward(wrongInput, output), neuro::exception::InvalidNetworkArchitectureException);
+    CHECK_THROWS_AS(neuro::NeuralNetwork().compile(), neuro::exception::InvalidNetworkArchitectureException);
+
+    neuro::NeuralNetwork mismatched({2, 3});
+    mismatched.addLayer(std::make_unique<neuro::DenseLayer>(4, 1));
+
+    CHECK_THROWS_AS(mismatched.compile(), neuro::exception::InvalidNetworkArchitectureException);
+  }
+}
+
 TEST_IMPL_INEURAL_NETWORK("NeuralNetwork", neuro::NeuralNetwork);
+
+TEST_CASE("NeuralNetwork - Overriding a built-in handler replaces the kernel") {
+  auto doubling = neuro::maker::activationSigmoid();
+  doubling.setActivate([](float x) { return x * 2.0f; });
+
+  CHECK(doubling.getKind() == neuro::ActivationKind::Custom);
+  CHECK(doubling.activate(3.0f) == 6.0f);
+
+  neuro::NeuralNetwork network({3, 4, 2}, {doubling, doubling});
+
+  network.randomizeWeights(-1.0f, 1.0f);
+  network.randomizeBiases(-1.0f, 1.0f);
+
+  neuro::neuro_layer_t input = {0.5f, -0.25f, 1.0f};
+  neuro::neuro_layer_t hidden(4);
+  neuro::neuro_layer_t expected(2);
+
+  const auto& first = network[0];
+  const auto& second = network[1];
+
+  for (size_t i = 0; i < hidden.size(); i++) {
+    float sum = first.getBiases()[i];
+
+    for (size_t j = 0; j < input.size(); j++) {
+      sum += first.getWeights()[i][j] * input[j];
+    }
+
+    hidden[i] = sum * 2.0f;
+  }
+
+  for (size_t i = 0; i < expected.size(); i++) {
+    float sum = second.getBiases()[i];
+
+    for (size_t j = 0; j < hidden.size(); j++) {
+      sum += second.getWeights()[i][j] * hidden[j];
+    }
+
+    expected[i] = sum * 2.0f;
+  }
+
+  const auto outputs = network.feedforward(input);
+  const auto compiled = network.compile().feedforward(input);
+
+  for (size_t i = 0; i < expected.size(); i++) {
+    CHECK(outputs[i] == doctest::Approx(expected[i]).epsilon(1e-5));
+    CHECK(compiled[i] == doctest::Approx(expected[i]).epsilon(1e-5));
+  }
+}
@@ -0,0 +1,363 @@
+#include "neuro/impl/population_arena.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+#include "neuro/impl/population.hpp"
+#include "neuro/makers/activation.hpp"
+#include "neuro/strategies/genetic_trainer.hpp"
+#include "neuro/utils/evaluation_budget.hpp"
+#include "neuro/utils/simd.hpp"
+
+namespace {
+
+  const std::vector<int> STRUCTURE = {3, 7, 2};
+
+  float targetFitness(const neuro::IndividualView& individual) {
+    const auto outputs = individual.feedforward({0.5f, -1.0f, 0.25f});
+
+    return -(outputs[0] - 0.3f) * (outputs[0] - 0.3f) - (outputs[1] + 0.2f) * (outputs[1] + 0.2f);
+  }
+
+} // namespace
+
+TEST_CASE("PopulationArena - Genomes are contiguous and aligned") {
+  neuro::PopulationArena arena(5, STRUCTURE, neuro::maker::activationTanh_fn());
+
+  CHECK(arena.size() == 5);
+  CHECK(arena.parameterCount() == 3 * 7 + 7 + 7 * 2 + 2);
+  CHECK(arena.stride() >= arena.parameterCount());
+  CHECK(arena.stride() - arena.parameterCount() < 16);
+
+  for (size_t i = 0; i < arena.size(); i++) {
+    CHECK(reinterpret_cast<uintptr_t>(arena.parameters(i)) % 64 == 0);
+  }
+
+  CHECK_THROWS_AS(neuro::PopulationArena(1, {3}), neuro::exception::InvalidNetworkArchitectureException);
+}
+
+TEST_CASE("PopulationArena - Matches a Population of networks with the same seeds") {
+  neuro::Population population(6, STRUCTURE, neuro::maker::activationTanh_fn());
+  neuro::PopulationArena arena(6, STRUCTURE, neuro::maker::activationTanh_fn());
+
+  population.randomizeWeights(-1.0f, 1.0f, 42);
+  population.randomizeBiases(-1.0f, 1.0f, 42);
+  arena.randomizeWeights(-1.0f, 1.0f, 42);
+  arena.randomizeBiases(-1.0f, 1.0f, 42);
+
+  for (size_t i = 0; i < population.size(); i++) {
+    population.get(i).getNeuralNetwork().mutateWeights([](float) { return 0.0f; });
+  }
+
+  auto compare = [&]() {
+    bool equal = true;
+
+    for (size_t i = 0; i < population.size(); i++) {
+      const auto network = arena.toNeuralNetwork(i);
+      equal = equal && network.getAllWeights() == population.get(i).getNeuralNetwork().getAllWeights();
+
+      for (size_t l = 0; l < network.sizeLayers(); l++) {
+        equal = equal && network.layer(l).getBiases() == population.get(i).getNeuralNetwork().layer(l).getBiases();
+      }
+    }
+
+    return equal;
+  };
+
+  CHECK(compare());
+
+  neuro::PopulationArena copied(population);
+
+  CHECK(copied.compatible(arena));
+  CHECK(copied.parameters(3)[5] == arena.parameters(3)[5]);
+
+  const neuro::neuro_layer_t input = {0.5f, -1.0f, 0.25f};
+
+  CHECK(arena[2].feedforward(input) == population.get(2).getNeuralNetwork().feedforward(input));
+
+  for (float rate : {0.05f, 0.5f}) {
+    for (size_t i = 0; i < population.size(); i++) {
+      const neuro::RandomKey key{7, 1, static_cast<uint32_t>(i)};
+      size_t l = 0;
+
+      for (auto& layer : population.get(i).getNeuralNetwork()) {
+        neuro::RandomStream weightRandom(key, static_cast<uint32_t>(l));
+        neuro::RandomStream biasRandom(key, static_cast<uint32_t>(l) | neuro::RandomStream::BIAS_STREAM);
+
+        layer->mutateWeights(rate, 0.0f, 0.5f, weightRandom);
+        layer->mutateBiases(rate, 0.0f, 0.5f, biasRandom);
+        l++;
+      }
+    }
+
+    arena.mutate(rate, 0.0f, 0.5f, 7, 1);
+
+    CHECK(compare());
+  }
+}
+
+TEST_CASE("PopulationArena - Trainer evolves an arena exactly like a population") {
+  auto population = std::make_shared<neuro::Population>(12, STRUCTURE, neuro::maker::activationTanh_fn());
+  population->randomizeWeights(-1.0f, 1.0f, 9);
+  population->randomizeBiases(-1.0f, 1.0f, 9);
+
+  neuro::PopulationArena arena(*population);
+
+  neuro::GeneticOptions options;
+  options.eliteCount = 2;
+  options.rate = 0.2f;
+  options.intensity = 0.2f;
+  options.seed = 31;
+
+  neuro::GeneticTrainer populationTrainer(population, options);
+  neuro::GeneticTrainer arenaTrainer(nullptr, options);
+
+  for (int generation = 0; generation < 5; generation++) {
+    arena.evaluateFitness(targetFitness);
+
+    for (size_t i = 0; i < population->size(); i++) {
+      population->get(i).setFitness(arena.getFitness(i));
+    }
+
+    populationTrainer.evolve();
+    arenaTrainer.evolve(arena);
+  }
+
+  bool equal = true;
+
+  for (size_t i = 0; i < arena.size(); i++) {
+    equal = equal && arena.toNeuralNetwork(i).getAllWeights() == population->get(i).getNeuralNetwork().getAllWeights();
+  }
+
+  CHECK(equal);
+  CHECK(arenaTrainer.getGeneration() == 5);
+}
+
+TEST_CASE("PopulationArena - Batched evaluation on a shared input batch") {
+  neuro::PopulationArena arena(9, STRUCTURE, neuro::maker::activationTanh_fn());
+
+  arena.randomizeWeights(-1.0f, 1.0f, 5);
+  arena.randomizeBiases(-1.0f, 1.0f, 5);
+
+  const size_t samples = 4;
+  const neuro::neuro_layer_t inputs = {0.5f, -1.0f, 0.25f, 1.0f, 0.0f, -0.5f, -0.25f, 0.75f, 2.0f, 0.1f, 0.2f, 0.3f};
+  const auto outputs = arena.feedforwardBatch(inputs, samples);
+
+  REQUIRE(outputs.size() == arena.size() * samples * arena.outputSize());
+
+  for (size_t i = 0; i < arena.size(); i++) {
+    for (size_t sample = 0; sample < samples; sample++) {
+      const neuro::neuro_layer_t input(inputs.begin() + sample * 3, inputs.begin() + (sample + 1) * 3);
+      const auto expected = arena[i].feedforward(input);
+
+      for (size_t o = 0; o < expected.size(); o++) {
+        CHECK(outputs[(i * samples + sample) * 2 + o] == doctest::Approx(expected[o]).epsilon(1e-5));
+      }
+    }
+  }
+
+  auto score = [](neuro::neuro_layer_const_span_t values) {
+    float total = 0.0f;
+
+    for (float value : values) {
+      total += value;
+    }
+
+    return total;
+  };
+
+  arena.evaluateFitnessBatch(inputs, samples, score, neuro::EvaluationOptions{0, 2});
+
+  for (size_t i = 0; i < arena.size(); i++) {
+    CHECK(arena.getFitness(i) == score({outputs.data() + i * samples * 2, samples * 2}));
+  }
+
+  CHECK_THROWS_AS(arena.feedforwardBatch(inputs, samples + 1), neuro::exception::InvalidNetworkArchitectureException);
+}
+
+TEST_CASE("PopulationArena - Lane evaluation of micro networks") {
+  const auto detected = neuro::detectSimdLevel();
+
+  neuro::PopulationArena arena(37, {2, 4, 1}, neuro::maker::activationSigmoid());
+
+  arena.randomizeWeights(-2.0f, 2.0f, 11);
+  arena.randomizeBiases(-2.0f, 2.0f, 11);
+
+  CHECK(arena.prefersLanes());
+  CHECK_FALSE(neuro::PopulationArena(15, {2, 4, 1}).prefersLanes());
+  CHECK_FALSE(neuro::PopulationArena(64, {2, 64, 1}).prefersLanes());
+
+  const neuro::neuro_layer_t inputs = {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f};
+  const size_t samples = 4;
+
+  for (auto level : {neuro::SimdLevel::Scalar, neuro::SimdLevel::SSE2, neuro::SimdLevel::AVX2, neuro::SimdLevel::AVX512}) {
+    if (level > detected) {
+      continue;
+    }
+
+    neuro::setSimdLevel(level);
+
+    neuro::neuro_layer_t outputs(arena.size() * samples);
+    arena.feedforwardLanes(inputs.data(), samples, outputs.data());
+
+    for (size_t i = 0; i < arena.size(); i++) {
+      for (size_t sample = 0; sample < samples; sample++) {
+        const auto expected = arena[i].feedforward({inputs[sample * 2], inputs[sample * 2 + 1]});
+
+        CHECK(outputs[i * samples + sample] == doctest::Approx(expected[0]).epsilon(1e-5));
+      }
+    }
+
+    CHECK(arena.feedforwardBatch(inputs, samples) == outputs);
+  }
+
+  neuro::setSimdLevel(detected);
+
+  const auto outputs = arena.feedforwardBatch(inputs, samples);
+
+  for (size_t chunkSize : {1, 20}) {
+    arena.evaluateFitnessBatch(inputs, samples, [](neuro::neuro_layer_const_span_t values) { return values[0] - values[3]; }, neuro::EvaluationOptions{0, chunkSize});
+
+    for (size_t i = 0; i < arena.size(); i++) {
+      CHECK(arena.getFitness(i) == outputs[i * samples] - outputs[i * samples + 3]);
+    }
+  }
+}
+
+TEST_CASE("PopulationArena - Top-k and alias selection") {
+  neuro::PopulationArena arena(50, STRUCTURE);
+  neuro::Population population(50, STRUCTURE, neuro::maker::activationSigmoid());
+
+  for (size_t i = 0; i < arena.size(); i++) {
+    arena.setFitness(i, static_cast<float>((i * 37) % 50));
+    population[i].setFitness(arena.getFitness(i));
+  }
+
+  const auto top = arena.topK(3);
+
+  REQUIRE(top.size() == 3);
+  CHECK(arena.getFitness(top[0]) == 49.0f);
+  CHECK(arena.getFitness(top[2]) == 47.0f);
+  CHECK(population.topK(3) == top);
+
+  for (auto selection : {neuro::SelectionKind::Rank, neuro::SelectionKind::Roulette}) {
+    neuro::GeneticOptions options;
+    options.selection = selection;
+    options.seed = 9;
+
+    neuro::PopulationArena copy = arena;
+    neuro::GeneticTrainer first(nullptr, options);
+    neuro::GeneticTrainer second(nullptr, options);
+
+    first.evolve(arena);
+    second.evolve(copy);
+
+    CHECK(std::equal(arena.parameters(0), arena.parameters(0) + arena.size() * arena.stride(), copy.parameters(0)));
+  }
+}
+
+TEST_CASE("PopulationArena - Evaluation budgets") {
+  neuro::PopulationArena arena(12, {2, 3, 1});
+  neuro::EvaluationCounters counters;
+
+  neuro::EvaluationOptions options;
+  options.stepLimit = 20;
+  options.timeoutFitness = -5.0f;
+  options.counters = &counters;
+
+  arena.evaluateFitness(
+    [](const neuro::IndividualView& individual, neuro::EvaluationToken& token) {
+      const size_t length = individual.getIndex() % 2 == 0 ? 10 : 100;
+      size_t steps = 0;
+
+      while (steps < length && token.step()) {
+        steps++;
+      }
+
+      return static_cast<float>(steps);
+    },
+    options);
+
+  CHECK(counters.completed == 6);
+  CHECK(counters.timedOut == 6);
+
+  for (size_t i = 0; i < arena.size(); i++) {
+    CHECK(arena.getFitness(i) == (i % 2 == 0 ? 10.0f : -5.0f));
+  }
+}
+
+TEST_CASE("PopulationArena - Batched evaluation honours cancellation and time limits") {
+  neuro::PopulationArena arena(40, {2, 3, 1});
+  arena.randomizeWeights(-1.0f, 1.0f, 6);
+
+  REQUIRE(arena.prefersLanes());
+
+  const neuro::neuro_layer_t inputs = {0.5f, -0.5f, 1.0f, 0.25f};
+
+  neuro::CancellationSource cancellation;
+  neuro::EvaluationCounters counters;
+
+  neuro::EvaluationOptions options;
+  options.threads = 1;
+  options.timeoutFitness = -1.0f;
+  options.cancellation = &cancellation;
+  options.counters = &counters;
+
+  SUBCASE("Cancellation stops the running lane group and skips the others") {
+    size_t calls = 0;
+
+    arena.evaluateFitnessBatch(
+      inputs,
+      2,
+      [&](neuro::neuro_layer_const_span_t) {
+        if (++calls == 20) {
+          cancellation.cancel();
+        }
+
+        return 2.0f;
+      },
+      options);
+
+    // The first group of 16 finished; the group cancelled mid-way and the last 8 are penalized.
+    CHECK(counters.completed == 16);
+    CHECK(counters.cancelled == 24);
+    CHECK(calls == 20);
+
+    for (size_t i = 0; i < arena.size(); i++) {
+      CHECK(arena.getFitness(i) == (i < 16 ? 2.0f : -1.0f));
+    }
+  }
+
+  SUBCASE("A lane group that overruns its time limit is penalized") {
+    size_t calls = 0;
+    options.timeLimit = std::chrono::milliseconds{2};
+    cancellation.reset();
+    counters.reset();
+
+    arena.evaluateFitnessBatch(
+      inputs,
+      2,
+      [&](neuro::neuro_layer_const_span_t) {
+        if (++calls == 17) {
+          std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+
+        return 3.0f;
+      },
+      options);
+
+    CHECK(counters.completed == 24);
+    CHECK(counters.timedOut == 16);
+    CHECK(arena.getFitness(0) == 3.0f);
+    CHECK(arena.getFitness(16) == -1.0f);
+    CHECK(arena.getFitness(31) == -1.0f);
+    CHECK(arena.getFitness(32) == 3.0f);
+  }
+}
@@ -1,5 +1,15 @@
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 #include "neuro/neuro.hpp"
 
 TEST_CASE("Tests for Population class") {
@@ -17,3 +27,457 @@ TEST_CASE("Check randomization population") {
   population.randomizeWeights(-5, 5);
   population.randomizeBiases(-5, 5);
 }
+
+TEST_CASE("Population - Parallel fitness evaluation") {
+  neuro::Population population(37, {2, 3, 1}, neuro::maker::activationSigmoid());
+
+  population.randomizeWeights(-1.0f, 1.0f);
+  population.randomizeBiases(-1.0f, 1.0f);
+
+  auto fitness = [](const neuro::INeuralNetwork& network) { return network.feedforward({0.5f, -0.5f})[0]; };
+
+  std::vector<float> expected;
+
+  for (const auto& individual : population) {
+    expected.push_back(fitness(individual->getNeuralNetwork()));
+  }
+
+  neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{3});
+
+  SUBCASE("Every individual is scored once whatever the chunking") {
+    for (size_t chunkSize : {1, 4, 100}) {
+      for (auto& individual : population) {
+        individual->setFitness(-1.0f);
+      }
+
+      population.evaluateFitness(fitness, neuro::EvaluationOptions{0, chunkSize});
+
+      for (size_t i = 0; i < population.size(); i++) {
+        CHECK(population[i].getFitness() == expected[i]);
+      }
+    }
+  }
+
+  SUBCASE("Each evaluator reuses its own scratch state") {
+    std::atomic<int> scratchCount{0};
+    std::atomic<int> evaluations{0};
+
+    population.evaluateFitness(
+      [&]() {
+        scratchCount++;
+        return std::vector<float>(2);
+      },
+      [&](const neuro::INeuralNetwork& network, std::vector<float>& scratch) {
+        scratch[0] = 0.5f;
+        scratch[1] = -0.5f;
+        evaluations++;
+
+        return network.feedforward(scratch)[0];
+      },
+      neuro::EvaluationOptions{2, 1});
+
+    CHECK(evaluations == 37);
+    CHECK(scratchCount >= 1);
+    CHECK(scratchCount <= 2);
+    CHECK(population[5].getFitness() == expected[5]);
+  }
+
+  SUBCASE("Exceptions from the fitness function reach the caller") {
+    CHECK_THROWS_AS(population.evaluateFitness([](const neuro::INeuralNetwork&) -> float { throw std::runtime_error("simulator crashed"); }),
+                    std::runtime_error);
+  }
+
+  neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{});
+}
+
+TEST_CASE("Population - Batched evaluation on a shared input batch") {
+  neuro::Population population(5, {2, 3, 1}, neuro::maker::activationSigmoid());
+  population.addIndividual(std::make_shared<neuro::Individual>(std::vector<int>{2, 4, 2}, neuro::maker::activationSigmoid()));
+
+  population.randomizeWeights(-1.0f, 1.0f, 3);
+  population.randomizeBiases(-1.0f, 1.0f, 3);
+
+  const neuro::neuro_layer_t inputs = {0.5f, -0.5f, 1.0f, 0.25f, -1.0f, 0.0f};
+  const auto outputs = population.feedforwardBatch(inputs, 3);
+
+  REQUIRE(outputs.size() == population.size());
+
+  for (size_t i = 0; i < population.size(); i++) {
+    const auto& network = population[i].getNeuralNetwork();
+
+    for (size_t sample = 0; sample < 3; sample++) {
+      const auto expected = network.feedforward({inputs[sample * 2], inputs[sample * 2 + 1]});
+
+      REQUIRE(outputs[i].size() == 3 * expected.size());
+
+      for (size_t o = 0; o < expected.size(); o++) {
+        CHECK(outputs[i][sample * expected.size() + o] == doctest::Approx(expected[o]).epsilon(1e-5));
+      }
+    }
+  }
+
+  population.evaluateFitnessBatch(inputs, 3, [](neuro::neuro_layer_const_span_t values) { return values[0] + values[values.size() - 1]; });
+
+  for (size_t i = 0; i < population.size(); i++) {
+    CHECK(population[i].getFitness() == outputs[i].front() + outputs[i].back());
+  }
+}
+
+TEST_CASE("Population - Unchanged and duplicate individuals are not re-evaluated") {
+  auto population = std::make_shared<neuro::Population>(20, std::vector<int>{2, 3, 1}, neuro::maker::activationSigmoid());
+
+  population->randomizeWeights(-1.0f, 1.0f, 5);
+  population->randomizeBiases(-1.0f, 1.0f, 5);
+
+  std::atomic<int> evaluations{0};
+  auto fitness = [&](const neuro::INeuralNetwork& network) {
+    evaluations++;
+    return network.feedforward({0.5f, -0.5f})[0];
+  };
+
+  neuro::EvaluationOptions options;
+  options.skipEvaluated = true;
+
+  population->evaluateFitness(fitness, options);
+  CHECK(evaluations == 20);
+
+  population->evaluateFitness(fitness, options);
+  CHECK(evaluations == 20);
+
+  neuro::GeneticOptions geneticOptions;
+  geneticOptions.eliteCount = 3;
+  geneticOptions.seed = 1;
+
+  neuro::GeneticTrainer trainer(population, geneticOptions);
+  trainer.evolve();
+
+  evaluations = 0;
+  population->evaluateFitness(fitness, options);
+  CHECK(evaluations == 17);
+
+  SUBCASE("Identical genomes are evaluated once through the cache") {
+    neuro::Population clones;
+
+    for (int i = 0; i < 6; i++) {
+      clones.addIndividual(population->get(0));
+    }
+
+    clones.get(5).getNeuralNetwork().layer(0).setWeight(0, 0, 4.0f);
+
+    neuro::FitnessCache cache;
+    neuro::EvaluationOptions cached;
+    cached.cache = &cache;
+
+    evaluations = 0;
+    clones.evaluateFitness(fitness, cached);
+
+    CHECK(evaluations == 2);
+    CHECK(cache.size() == 2);
+
+    for (size_t i = 0; i < 5; i++) {
+      CHECK(clones[i].getFitness() == population->get(0).getFitness());
+      CHECK(clones[i].isFitnessCurrent());
+    }
+
+    clones.get(5).getNeuralNetwork().layer(0).setWeight(0, 0, population->get(0).getNeuralNetwork().layer(0).getWeight(0, 0));
+    clones.evaluateFitness(fitness, cached);
+
+    CHECK(evaluations == 2);
+    CHECK(cache.hits() == 6);
+  }
+}
+
+TEST_CASE("Population - Evaluation budgets penalize runaway individuals") {
+  neuro::Population population(24, std::vector<int>{2, 3, 1});
+  population.randomizeWeights(-1.0f, 1.0f, 8);
+
+  // Every third individual never ends its episode on its own.
+  auto episode = [&](const neuro::INeuralNetwork& network, neuro::EvaluationToken& token) {
+    const bool runaway = &network == &population.get(0).getNeuralNetwork() || &network == &population.get(3).getNeuralNetwork() ||
+                         &network == &population.get(6).getNeuralNetwork();
+    float reward = 0.0f;
+
+    while (token.step()) {
+      reward += 1.0f;
+
+      if (!runaway && reward == 10.0f) {
+        break;
+      }
+    }
+
+    return reward;
+  };
+
+  neuro::EvaluationCounters counters;
+  neuro::FitnessCache cache;
+
+  neuro::EvaluationOptions options;
+  options.stepLimit = 50;
+  options.timeoutFitness = -1.0f;
+  options.counters = &counters;
+  options.cache = &cache;
+
+  population.evaluateFitness(episode, options);
+
+  CHECK(counters.completed == 21);
+  CHECK(counters.timedOut == 3);
+  CHECK(cache.size() == 21);
+
+  for (size_t i = 0; i < population.size(); i++) {
+    const bool runaway = i == 0 || i == 3 || i == 6;
+
+    CHECK(population[i].getFitness() == (runaway ? -1.0f : 10.0f));
+    CHECK(population[i].isFitnessCurrent() != runaway);
+  }
+
+  SUBCASE("Functions that ignore their token are penalized once they overrun") {
+    options.stepLimit = 0;
+    options.cache = nullptr;
+    options.timeLimit = std::chrono::milliseconds{2};
+    counters.reset();
+
+    population.evaluateFitness(
+      [&](const neuro::INeuralNetwork& network) {
+        if (&network == &population.get(5).getNeuralNetwork()) {
+          std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+
+        return 1.0f;
+      },
+      options);
+
+    CHECK(counters.timedOut == 1);
+    CHECK(population[5].getFitness() == -1.0f);
+    CHECK(population[4].getFitness() == 1.0f);
+  }
+
+  SUBCASE("Cancellation stops running and pending evaluations") {
+    neuro::CancellationSource cancellation;
+
+    options.cache = nullptr;
+    options.stepLimit = 0;
+    options.threads = 1;
+    options.cancellation = &cancellation;
+    counters.reset();
+
+    population.evaluateFitness(
+      [&](const neuro::INeuralNetwork& network, neuro::EvaluationToken& token) {
+        if (&network == &population.get(10).getNeuralNetwork()) {
+          cancellation.cancel();
+        }
+
+        return token.step() ? 2.0f : 0.0f;
+      },
+      options);
+
+    CHECK(counters.completed == 10);
+    CHECK(counters.cancelled == 14);
+    CHECK(population[9].getFitness() == 2.0f);
+    CHECK(population[10].getFitness() == -1.0f);
+    CHECK(population[23].getFitness() == -1.0f);
+  }
+}
+
+TEST_CASE("Population - Roulette selection skips timed-out individuals") {
+  neuro::Population population(6, std::vector<int>{2, 3, 1});
+
+  neuro::EvaluationOptions options;
+  options.stepLimit = 5;
+  options.threads = 1;
+
+  population.evaluateFitness(
+    [&](const neuro::INeuralNetwork& network, neuro::EvaluationToken& token) {
+      if (&network == &population.get(2).getNeuralNetwork()) {
+        while (token.step()) {}
+      }
+
+      for (size_t i = 0; i < population.size(); i++) {
+        if (&network == &population.get(i).getNeuralNetwork()) {
+          return static_cast<float>(i);
+        }
+      }
+
+      return 0.0f;
+    },
+    options);
+
+  const std::vector<float> fitness = population.getFitnesses();
+
+  CHECK(std::isfinite(fitness[2]));
+  CHECK(!population[2].isFitnessCurrent());
+
+  neuro::RandomStream random(9, 0, 0, 0);
+  neuro::Selector selector;
+  selector.prepare(neuro::SelectionKind::Roulette, fitness.data(), fitness.size(), 3, 1.5f);
+
+  const int draws = 60000;
+  std::vector<int> counts(fitness.size());
+
+  for (int i = 0; i < draws; i++) {
+    counts[selector(random)]++;
+  }
+
+  // Weighted from the lowest completed score, 0: individuals 1, 3, 4 and 5 share 13 parts.
+  CHECK(counts[0] == 0);
+  CHECK(counts[2] == 0);
+  CHECK(static_cast<float>(counts[5]) / draws == doctest::Approx(5.0f / 13.0f).epsilon(0.05));
+}
+
+TEST_CASE("Population - Successive-halving racing evaluation") {
+  const size_t datasetSize = 1024;
+
+  // Individual i scores i on every sample, so racing must keep the highest indices.
+  neuro::Population population(16, std::vector<int>{1, 1});
+  std::vector<const neuro::INeuralNetwork*> networks;
+
+  for (const auto& individual : population) {
+    networks.push_back(&individual->getNeuralNetwork());
+  }
+
+  std::vector<size_t> seen(population.size(), 0);
+  std::vector<bool> visited(datasetSize, false);
+
+  auto score = [&](const neuro::INeuralNetwork& network, const size_t* samples, size_t count) {
+    const size_t index = std::find(networks.begin(), networks.end(), &network) - networks.begin();
+    seen[index] += count;
+
+    for (size_t s = 0; s < count; s++) {
+      visited[samples[s]] = true;
+    }
+
+    return static_cast<float>(index * count);
+  };
+
+  const auto options = neuro::RacingOptions::halving(64, datasetSize, 4);
+
+  CHECK(options.rungs == std::vector<size_t>{64, 256, 1024});
+  CHECK(options.keepFraction == 0.25f);
+
+  const size_t scored = population.evaluateFitnessRacing(datasetSize, score, options);
+
+  // 16 individuals on 64 samples, 4 on the next 192 and 1 on the last 768.
+  CHECK(scored == 16 * 64 + 4 * 192 + 768);
+  CHECK(scored < population.size() * datasetSize / 5);
+  CHECK(std::all_of(visited.begin(), visited.end(), [](bool v) { return v; }));
+
+  for (size_t i = 0; i < population.size(); i++) {
+    CHECK(population[i].getFitness() == static_cast<float>(i));
+    CHECK(seen[i] == (i == 15 ? 1024u : i >= 12 ? 256u : 64u));
+    CHECK(population[i].isFitnessCurrent() == (i == 15));
+  }
+
+  CHECK(&population.getBestIndividual() == &population[15]);
+
+  SUBCASE("Individuals that run out of budget leave the race with the penalty") {
+    neuro::RacingOptions budgeted = options;
+    budgeted.evaluation.timeLimit = std::chrono::milliseconds{2};
+    budgeted.evaluation.timeoutFitness = -1.0f;
+
+    population.evaluateFitnessRacing(
+      datasetSize,
+      [&](const neuro::INeuralNetwork& network, const size_t* samples, size_t count) {
+        if (&network == networks[15]) {
+          std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+
+        return score(network, samples, count);
+      },
+      budgeted);
+
+    CHECK(population[15].getFitness() == -1.0f);
+    CHECK(population[14].getFitness() == 14.0f);
+    CHECK(population[14].isFitnessCurrent());
+  }
+
+  CHECK_THROWS_AS(population.evaluateFitnessRacing(datasetSize, score, neuro::RacingOptions{{64, 64}}), neuro::exception::InvalidNetworkArchitectureException);
+  CHECK_THROWS_AS(population.evaluateFitnessRacing(10, score, options), neuro::exception::InvalidNetworkArchitectureException);
+}
+
+TEST_CASE("Population - Racing keeps eliminated individuals below the finalists") {
+  const size_t datasetSize = 256;
+
+  neuro::Population population(64, std::vector<int>{1, 1});
+  std::vector<const neuro::INeuralNetwork*> networks;
+
+  for (const auto& individual : population) {
+    networks.push_back(&individual->getNeuralNetwork());
+  }
+
+  // Quality grows slowly with the index and every sample adds noise far larger than the gaps.
+  auto noisy = [](size_t index, size_t sample) {
+    neuro::RandomStream random(99, 0, static_cast<uint32_t>(index), static_cast<uint32_t>(sample));
+    return 0.01f * static_cast<float>(index) + 10.0f * (random.uniform() - 0.5f);
+  };
+
+  std::vector<double> sums(population.size(), 0.0);
+  std::vector<size_t> seen(population.size(), 0);
+
+  auto score = [&](const neuro::INeuralNetwork& network, const size_t* samples, size_t count) {
+    const size_t index = std::find(networks.begin(), networks.end(), &network) - networks.begin();
+    float total = 0.0f;
+
+    for (size_t s = 0; s < count; s++) {
+      total += noisy(index, samples[s]);
+    }
+
+    sums[index] += total;
+    seen[index] += count;
+
+    return total;
+  };
+
+  auto options = neuro::RacingOptions::halving(4, datasetSize, 4);
+  options.seed = 12;
+
+  population.evaluateFitnessRacing(datasetSize, score, options);
+
+  float lowestFinalist = std::numeric_limits<float>::infinity();
+  float highestPartial = -std::numeric_limits<float>::infinity();
+
+  for (size_t i = 0; i < population.size(); i++) {
+    if (seen[i] == datasetSize) {
+      lowestFinalist = std::min(lowestFinalist, population[i].getFitness());
+    } else if (seen[i] == options.rungs[0]) {
+      highestPartial = std::max(highestPartial, static_cast<float>(sums[i] / seen[i]));
+    }
+  }
+
+  // The situation racing must guard against: a lucky start beats every finalist's full mean.
+  REQUIRE(highestPartial > lowestFinalist);
+
+  const auto& best = population.getBestIndividual();
+
+  CHECK(best.isFitnessCurrent());
+
+  for (size_t i = 0; i < population.size(); i++) {
+    if (seen[i] < datasetSize) {
+      CHECK(population[i].getFitness() < lowestFinalist);
+      CHECK_FALSE(population[i].isFitnessCurrent());
+    }
+  }
+
+  // Later eliminations rank above earlier ones.
+  for (size_t i = 0; i < population.size(); i++) {
+    for (size_t j = 0; j < population.size(); j++) {
+      if (seen[i] > seen[j]) {
+        CHECK(population[i].getFitness() > population[j].getFitness());
+      }
+    }
+  }
+}
+
+TEST_CASE("Population - Racing accepts infinite mean scores") {
+  neuro::Population population(4, std::vector<int>{1, 1});
+  const auto* sink = &population.get(2).getNeuralNetwork();
+
+  population.evaluateFitnessRacing(
+    16,
+    [&](const neuro::INeuralNetwork& network, const size_t*, size_t count) {
+      return &network == sink ? -std::numeric_limits<float>::infinity() : static_cast<float>(count);
+    },
+    neuro::RacingOptions{});
+
+  CHECK(population[2].getFitness() == -std::numeric_limits<float>::infinity());
+  CHECK(population[2].isFitnessCurrent());
+  CHECK(population[0].getFitness() == 1.0f);
+}
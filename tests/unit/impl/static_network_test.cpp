@@ -0,0 +1,58 @@
+#include "neuro/impl/static_network.hpp"
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+#include "neuro/impl/neural_network.hpp"
+#include "neuro/makers/activation.hpp"
+#include "neuro/types.hpp"
+
+using XorNetwork = neuro::StaticNetwork<neuro::ActivationKind::Sigmoid, 2, 4, 1>;
+
+TEST_CASE("StaticNetwork - Compile-time shape") {
+  CHECK(XorNetwork::LAYER_COUNT == 2);
+  CHECK(XorNetwork::INPUT_SIZE == 2);
+  CHECK(XorNetwork::OUTPUT_SIZE == 1);
+  CHECK(XorNetwork::MAX_WIDTH == 4);
+  CHECK(XorNetwork::PARAMETER_COUNT == 4 * 3 + 1 * 5);
+
+  XorNetwork network;
+
+  network.weight(1, 0, 3) = 2.0f;
+  network.bias(1, 0) = -1.0f;
+
+  CHECK(network.getParameters()[12 + 3] == 2.0f);
+  CHECK(network.getParameters()[12 + 4] == -1.0f);
+}
+
+TEST_CASE("StaticNetwork - Matches NeuralNetwork and round-trips through it") {
+  neuro::NeuralNetwork dynamic({3, 5, 4, 2}, neuro::maker::activationTanh_fn());
+
+  dynamic.randomizeWeights(-1.0f, 1.0f);
+  dynamic.randomizeBiases(-1.0f, 1.0f);
+
+  neuro::StaticNetwork<neuro::ActivationKind::Tanh, 3, 5, 4, 2> fixed(dynamic);
+
+  const neuro::neuro_layer_t inputs = {0.3f, -0.7f, 1.2f};
+  const auto expected = dynamic.feedforward(inputs);
+  const auto outputs = fixed({0.3f, -0.7f, 1.2f});
+
+  for (size_t i = 0; i < outputs.size(); i++) {
+    CHECK(outputs[i] == doctest::Approx(expected[i]).epsilon(1e-5));
+  }
+
+  auto restored = fixed.toNeuralNetwork();
+
+  CHECK(restored.getAllWeights() == dynamic.getAllWeights());
+  CHECK(restored.getAllBiases() == dynamic.getAllBiases());
+  CHECK(restored.feedforward(inputs) == expected);
+}
+
+TEST_CASE("StaticNetwork - Rejects networks of another shape or activation") {
+  CHECK_THROWS_AS(XorNetwork(neuro::NeuralNetwork({2, 3, 1}, neuro::maker::activationSigmoid())), neuro::exception::InvalidNetworkArchitectureException);
+  CHECK_THROWS_AS(XorNetwork(neuro::NeuralNetwork({2, 1}, neuro::maker::activationSigmoid())), neuro::exception::InvalidNetworkArchitectureException);
+  CHECK_THROWS_AS(XorNetwork(neuro::NeuralNetwork({2, 4, 1}, neuro::maker::activationRelu())), neuro::exception::InvalidNetworkArchitectureException);
+  CHECK_NOTHROW(XorNetwork(neuro::NeuralNetwork({2, 4, 1}, neuro::maker::activationSigmoid())));
+}
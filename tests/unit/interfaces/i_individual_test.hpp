@@ -62,6 +62,30 @@ void runTestInterfaceIIndividual() {
     CHECK(individual.getFitness() == doctest::Approx(10.0f));
   }
 
+  SUBCASE("Fitness stays current until the network changes") {
+    IIndividualImpl individual;
+    individual.setNeuralNetwork(neuro::NeuralNetwork({2, 3, 1}));
+
+    CHECK_FALSE(individual.isFitnessCurrent());
+
+    individual.evaluateFitness([](const neuro::INeuralNetwork&) { return 1.0f; });
+
+    CHECK(individual.isFitnessCurrent());
+    CHECK(individual.clone()->isFitnessCurrent());
+
+    individual.getNeuralNetwork().layer(0).setWeight(0, 0, 1.0f);
+
+    CHECK_FALSE(individual.isFitnessCurrent());
+
+    individual.markEvaluated(2.0f);
+
+    CHECK(individual.isFitnessCurrent());
+
+    individual.setFitness(3.0f);
+
+    CHECK_FALSE(individual.isFitnessCurrent());
+  }
+
   SUBCASE("Clone") {
     IIndividualImpl original;
 
@@ -243,6 +243,38 @@ void runTestInterfaceILayer() {
     CHECK(output[1] == doctest::Approx(std::max(0.0f, 0.4f * 1 + 0.5f * 2 + 0.6f * 3 - 0.5f)));
   }
 
+  SUBCASE("Batched feedforward matches per-sample feedforward") {
+    ILayerImpl layer;
+
+    layer.reshape(37, 11);
+    layer.randomizeWeights(-1.0f, 1.0f);
+    layer.randomizeBiases(-1.0f, 1.0f);
+
+    layer.setActivationFunction(neuro::maker::activationTanh_fn());
+
+    const size_t batchSize = 9;
+    neuro::neuro_layer_t inputs(batchSize * layer.inputSize());
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+      inputs[i] = static_cast<float>(i % 13) / 13.0f - 0.5f;
+    }
+
+    auto outputs = layer.feedforwardBatch(inputs, batchSize);
+
+    REQUIRE(outputs.size() == batchSize * layer.outputSize());
+
+    for (size_t s = 0; s < batchSize; s++) {
+      neuro::neuro_layer_t sample(inputs.begin() + s * layer.inputSize(), inputs.begin() + (s + 1) * layer.inputSize());
+      auto expected = layer.feedforward(sample);
+
+      for (size_t i = 0; i < expected.size(); i++) {
+        CHECK(outputs[s * layer.outputSize() + i] == doctest::Approx(expected[i]).epsilon(1e-5));
+      }
+    }
+
+    CHECK_THROWS_AS(layer.feedforwardBatch(inputs, batchSize + 1), neuro::exception::InvalidNetworkArchitectureException);
+  }
+
   SUBCASE("Index exception tests outside the range of weight and bias vectors") {
     ILayerImpl layer;
 
@@ -303,6 +335,50 @@ void runTestInterfaceILayer() {
     CHECK(layer.meanBias() == doctest::Approx(sum / biases.size()));
   }
 
+  SUBCASE("Every mutating call changes the version and copies keep it") {
+    ILayerImpl layer(2, 3);
+    const ILayerImpl& view = layer;
+
+    auto version = layer.getVersion();
+
+    auto changes = [&]() {
+      const bool changed = layer.getVersion() != version;
+      version = layer.getVersion();
+
+      return changed;
+    };
+
+    CHECK(view.getWeights().rows() == 3);
+    CHECK(view.getWeight(0, 0) == 0.0f);
+    CHECK_FALSE(changes());
+
+    layer.setWeight(0, 0, 1.0f);
+    CHECK(changes());
+
+    layer.setBias(0, 1.0f);
+    CHECK(changes());
+
+    layer.randomizeWeights(-1.0f, 1.0f);
+    CHECK(changes());
+
+    layer.mutateBiases([](float) { return 0.5f; });
+    CHECK(changes());
+
+    layer.blendWith(ILayerImpl(2, 3), 0.5f);
+    CHECK(changes());
+
+    layer.weightRef(1, 1) = 2.0f;
+    CHECK(changes());
+
+    layer.getBiases()[2] = 2.0f;
+    CHECK(changes());
+
+    const ILayerImpl copy = layer;
+    CHECK(copy.getVersion() == layer.getVersion());
+    CHECK(layer.clone()->getVersion() == layer.getVersion());
+    CHECK(ILayerImpl(2, 3).getVersion() != ILayerImpl(2, 3).getVersion());
+  }
+
   SUBCASE("Testing the internal structure of the layer") {
     SUBCASE("Correct inner layer") {
       ILayerImpl layer;
@@ -325,15 +401,8 @@ void runTestInterfaceILayer() {
     SUBCASE("Layer with weight matrix with different outputs") {
       ILayerImpl layer;
 
-      layer.setWeights({{1.0f}, {1.0f, 3.0f}});
-      layer.setBiases({1.0f, -1.0f});
-
-      CHECK(!layer.validateInternalShape());
-
-      layer.setWeights({{1.0f, 3.0f}, {1.0f}});
-      layer.setBiases({1.0f, -1.0f});
-
-      CHECK(!layer.validateInternalShape());
+      CHECK_THROWS_AS(layer.setWeights({{1.0f}, {1.0f, 3.0f}}), neuro::exception::InvalidNetworkArchitectureException);
+      CHECK_THROWS_AS(layer.setWeights({{1.0f, 3.0f}, {1.0f}}), neuro::exception::InvalidNetworkArchitectureException);
     }
   }
 }
@@ -76,6 +76,41 @@ void runTestInterfaceINeuralNetwork() {
     CHECK(network(input) == output);
   }
 
+  SUBCASE("Batched feedforward matches per-sample feedforward") {
+    INeuralNetworkImpl network;
+
+    network.restructure({5, 16, 9, 3});
+    network.randomizeWeights(-1.0f, 1.0f);
+    network.randomizeBiases(-1.0f, 1.0f);
+
+    const size_t batchSize = 23;
+    neuro::neuro_layer_t inputs(batchSize * network.inputSize());
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+      inputs[i] = static_cast<float>(i % 7) / 7.0f - 0.5f;
+    }
+
+    neuro::BatchOptions options;
+    options.threads = 4;
+
+    auto outputs = network.feedforwardBatch(inputs, batchSize);
+    auto threadedOutputs = network.feedforwardBatch(inputs, batchSize, options);
+
+    REQUIRE(outputs.size() == batchSize * network.outputSize());
+    CHECK(threadedOutputs == outputs);
+
+    for (size_t s = 0; s < batchSize; s++) {
+      neuro::neuro_layer_t sample(inputs.begin() + s * network.inputSize(), inputs.begin() + (s + 1) * network.inputSize());
+      auto expected = network.feedforward(sample);
+
+      for (size_t i = 0; i < expected.size(); i++) {
+        CHECK(outputs[s * network.outputSize() + i] == doctest::Approx(expected[i]).epsilon(1e-4));
+      }
+    }
+
+    CHECK_THROWS_AS(network.feedforwardBatch(inputs, batchSize - 1), neuro::exception::InvalidNetworkArchitectureException);
+  }
+
   SUBCASE("Add layers") {
     INeuralNetworkImpl network;
 
@@ -318,7 +353,7 @@ void runTestInterfaceINeuralNetwork() {
     SUBCASE("Resetting neural network state and defining a new structure") {
       std::vector<std::unique_ptr<neuro::ILayer>> layers;
 
-      neuro::layer_weight_t weights = {{1.0f, 2.0f}, {3.0f, 4.0f, 2.0f}, {5.0f, 6.0f, 2.0f}};
+      neuro::layer_weight_t weights = {{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}};
       neuro::layer_bias_t biases = {1.0f, -1.0f, 0.0f};
 
       layers.push_back(std::make_unique<neuro::DenseLayer>(weights, biases));
@@ -1,6 +1,13 @@
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "neuro/exceptions/exception.hpp"
 #include "neuro/makers/makers.hpp"
+#include "neuro/utils/simd.hpp"
 
 TEST_CASE("Activation - Sigmoid") {
   auto sigmoid(neuro::maker::activationSigmoid());
@@ -105,3 +112,145 @@ TEST_CASE("Activation - Identity") {
   CHECK(identity.derivate(-1.0f) == doctest::Approx(1.0f));
   CHECK(identity.derivate(1.0f) == doctest::Approx(1.0f));
 }
+
+TEST_CASE("Activation - Kinds are inspectable and round-trip through the maker") {
+  const neuro::ActivationKind kinds[] = {
+    neuro::ActivationKind::Identity,
+    neuro::ActivationKind::Sigmoid,
+    neuro::ActivationKind::Relu,
+    neuro::ActivationKind::Tanh,
+    neuro::ActivationKind::LeakyRelu,
+    neuro::ActivationKind::Elu,
+    neuro::ActivationKind::Swish,
+    neuro::ActivationKind::Softplus,
+    neuro::ActivationKind::HardSigmoid,
+  };
+
+  CHECK(neuro::maker::activationSigmoid().getKind() == neuro::ActivationKind::Sigmoid);
+  CHECK(neuro::maker::activationLeaky_relu().getKind() == neuro::ActivationKind::LeakyRelu);
+  CHECK(std::string(neuro::activationName(neuro::ActivationKind::HardSigmoid)) == "hard_sigmoid");
+
+  for (auto kind : kinds) {
+    auto activation = neuro::maker::activation(kind);
+
+    CHECK(activation.getKind() == kind);
+    CHECK(std::string(neuro::activationName(kind)) != "custom");
+  }
+
+  CHECK_THROWS_AS(neuro::maker::activation(neuro::ActivationKind::Custom), neuro::exception::NeuroException);
+}
+
+TEST_CASE("Activation - Array application matches element-wise activation on every SIMD level") {
+  const auto detected = neuro::detectSimdLevel();
+
+  std::vector<float> inputs;
+
+  for (int i = -40; i <= 40; i++) {
+    inputs.push_back(static_cast<float>(i) * 0.37f);
+  }
+
+  for (int kind = static_cast<int>(neuro::ActivationKind::Identity); kind <= static_cast<int>(neuro::ActivationKind::HardSigmoid); kind++) {
+    auto activation = neuro::maker::activation(static_cast<neuro::ActivationKind>(kind));
+
+    for (auto level : {neuro::SimdLevel::Scalar, neuro::SimdLevel::SSE2, neuro::SimdLevel::AVX2, neuro::SimdLevel::AVX512}) {
+      if (level > detected) {
+        continue;
+      }
+
+      neuro::setSimdLevel(level);
+
+      auto values = inputs;
+      activation.apply(values.data(), values.size());
+
+      for (size_t i = 0; i < values.size(); i++) {
+        CHECK(values[i] == doctest::Approx(activation.activate(inputs[i])));
+      }
+    }
+  }
+
+  neuro::setSimdLevel(detected);
+}
+
+TEST_CASE("Activation - Custom activations are applied through the handler") {
+  neuro::ActivationFunction custom{[](float x) { return x * 3.0f; }, [](float) { return 3.0f; }};
+
+  CHECK(custom.getKind() == neuro::ActivationKind::Custom);
+
+  std::vector<float> values = {1.0f, -2.0f, 0.5f};
+  custom.apply(values.data(), values.size());
+
+  CHECK(values == std::vector<float>{3.0f, -6.0f, 1.5f});
+}
+
+TEST_CASE("Activation - Fast and table precisions stay within their documented error") {
+  const auto detected = neuro::detectSimdLevel();
+
+  const neuro::ActivationKind kinds[] = {
+    neuro::ActivationKind::Sigmoid,
+    neuro::ActivationKind::Tanh,
+    neuro::ActivationKind::Elu,
+    neuro::ActivationKind::Swish,
+    neuro::ActivationKind::Softplus,
+  };
+
+  std::vector<float> inputs;
+
+  for (int i = -40000; i <= 40000; i++) {
+    inputs.push_back(static_cast<float>(i) * 0.0005f);
+  }
+
+  inputs.insert(inputs.end(), {-100.0f, -87.5f, 87.5f, 100.0f});
+
+  for (auto kind : kinds) {
+    auto exact = neuro::maker::activation(kind);
+    const bool relative = kind == neuro::ActivationKind::Swish || kind == neuro::ActivationKind::Softplus;
+
+    for (auto precision : {neuro::ActivationPrecision::Fast, neuro::ActivationPrecision::Table}) {
+      auto approximate = neuro::maker::activation(kind, precision);
+      const float tolerance = precision == neuro::ActivationPrecision::Fast ? 1e-6f : 1e-5f;
+
+      CHECK(approximate.getPrecision() == precision);
+
+      for (auto level : {neuro::SimdLevel::Scalar, neuro::SimdLevel::SSE2, neuro::SimdLevel::AVX2, neuro::SimdLevel::AVX512}) {
+        if (level > detected) {
+          continue;
+        }
+
+        neuro::setSimdLevel(level);
+
+        auto values = inputs;
+        approximate.apply(values.data(), values.size());
+
+        float worst = 0.0f;
+
+        for (size_t i = 0; i < values.size(); i++) {
+          const float expected = exact.activate(inputs[i]);
+          const float scale = relative ? std::max(1.0f, std::fabs(inputs[i])) : 1.0f;
+
+          if (std::isfinite(expected)) {
+            worst = std::max(worst, std::fabs(values[i] - expected) / scale);
+          }
+        }
+
+        CHECK(worst <= tolerance);
+      }
+    }
+  }
+
+  neuro::setSimdLevel(detected);
+}
+
+TEST_CASE("Activation - Approximate precisions leave piecewise linear kinds exact") {
+  std::vector<float> inputs = {-3.0f, -0.5f, 0.0f, 0.25f, 4.0f};
+
+  for (auto precision : {neuro::ActivationPrecision::Fast, neuro::ActivationPrecision::Table}) {
+    auto leaky = neuro::maker::activation(neuro::ActivationKind::LeakyRelu, precision);
+
+    auto values = inputs;
+    leaky.apply(values.data(), values.size());
+
+    for (size_t i = 0; i < values.size(); i++) {
+      CHECK(values[i] == leaky.activate(inputs[i]));
+    }
+  }
+}
@@ -2,13 +2,20 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <vector>
 
 #include "neuro/impl/population.hpp"
 #include "neuro/interfaces/i_population.hpp"
 #include "neuro/makers/activation.hpp"
+#include "neuro/utils/thread_pool.hpp"
 
 TEST_CASE("GeneticTrainer - Testing changes to option parameters") {
   std::vector<int> structure = {1, 1};
@@ -70,3 +77,317 @@ TEST_CASE("GeneticTrainer - Testing changes in weights and biases through mutati
     }
   }
 }
+
+TEST_CASE("GeneticTrainer - Mutation perturbs parameters around zero") {
+  auto population = std::make_shared<neuro::Population>(40, std::vector<int>{8, 8, 8});
+
+  neuro::GeneticOptions options;
+  options.rate = 1.0f;
+  options.intensity = 1.0f;
+  options.seed = 5;
+
+  neuro::GeneticTrainer trainer(population, options);
+  trainer.mutate();
+
+  double total = 0.0;
+  double squares = 0.0;
+  size_t count = 0;
+
+  for (const auto& individual : *population) {
+    const auto& network = individual->getNeuralNetwork();
+
+    for (size_t l = 0; l < network.sizeLayers(); l++) {
+      const auto& layer = network.layer(l);
+
+      for (size_t row = 0; row < layer.outputSize(); row++) {
+        for (size_t col = 0; col < layer.inputSize(); col++) {
+          total += layer.getWeight(row, col);
+          squares += layer.getWeight(row, col) * layer.getWeight(row, col);
+          count++;
+        }
+
+        total += layer.getBias(row);
+        squares += layer.getBias(row) * layer.getBias(row);
+        count++;
+      }
+    }
+  }
+
+  CHECK(std::abs(total / count) < 0.05);
+  CHECK(std::sqrt(squares / count) == doctest::Approx(1.0).epsilon(0.05));
+}
+
+TEST_CASE("GeneticTrainer - Mutation is reproducible for any thread count") {
+  auto mutateWith = [](size_t workers) {
+    neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{workers});
+
+    auto population = std::make_shared<neuro::Population>(9, std::vector<int>{3, 5, 2});
+    population->randomizeWeights(-1.0f, 1.0f, 99);
+    population->randomizeBiases(-1.0f, 1.0f, 99);
+
+    neuro::GeneticOptions options;
+    options.seed = 2024;
+
+    neuro::GeneticTrainer trainer(population, options);
+    trainer.mutate();
+    trainer.mutate();
+
+    CHECK(trainer.getGeneration() == 2);
+
+    std::vector<std::vector<neuro::layer_weight_t>> weights;
+
+    for (const auto& individual : *population) {
+      weights.push_back(individual->getNeuralNetwork().getAllWeights());
+    }
+
+    return weights;
+  };
+
+  const auto serial = mutateWith(0);
+
+  CHECK(mutateWith(3) == serial);
+  CHECK(serial[0] != serial[1]);
+
+  neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{});
+}
+
+// Counted by the replacement operator new in impl/neural_network.cpp.
+extern std::atomic<size_t> allocationCount;
+
+namespace {
+
+  float distanceFitness(const neuro::INeuralNetwork& network) {
+    float total = 0.0f;
+
+    for (const auto& layer : network) {
+      for (size_t i = 0; i < layer->getWeights().rows(); i++) {
+        for (float weight : layer->getWeights().row(i)) {
+          total += (weight - 0.5f) * (weight - 0.5f);
+        }
+      }
+    }
+
+    return -total;
+  }
+
+} // namespace
+
+TEST_CASE("GeneticTrainer - Evolve keeps the elites and improves the population") {
+  auto population = std::make_shared<neuro::Population>(40, std::vector<int>{4, 6, 2});
+  population->randomizeWeights(-1.0f, 1.0f, 5);
+
+  neuro::GeneticOptions options;
+  options.rate = 0.1f;
+  options.intensity = 0.1f;
+  options.eliteCount = 2;
+  options.seed = 77;
+
+  neuro::GeneticTrainer trainer(population, options);
+
+  population->evaluateFitness(distanceFitness);
+  const float initialBest = population->getBestIndividual().getFitness();
+  const auto initial = population->getFitnesses();
+
+  const auto* best = &population->getBestIndividual();
+  const auto bestWeights = best->getNeuralNetwork().getAllWeights();
+
+  trainer.evolve();
+
+  CHECK(trainer.getGeneration() == 1);
+  CHECK(population->size() == 40);
+  CHECK(&population->get(0) == best);
+  CHECK(population->get(0).getNeuralNetwork().getAllWeights() == bestWeights);
+
+  // Without elites the best individual is not carried over, so only selection can make progress.
+  trainer.setEliteCount(0);
+
+  for (int generation = 0; generation < 30; generation++) {
+    population->evaluateFitness(distanceFitness);
+    trainer.evolve();
+  }
+
+  population->evaluateFitness(distanceFitness);
+
+  const auto final = population->getFitnesses();
+
+  CHECK(population->getBestIndividual().getFitness() > initialBest);
+  CHECK(std::accumulate(final.begin(), final.end(), 0.0f) / final.size() > std::accumulate(initial.begin(), initial.end(), 0.0f) / initial.size());
+}
+
+TEST_CASE("GeneticTrainer - Evolve is reproducible and allocation-free once warm") {
+  auto evolveWith = [](size_t workers) {
+    neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{workers});
+
+    auto population = std::make_shared<neuro::Population>(16, std::vector<int>{3, 5, 2});
+    population->randomizeWeights(-1.0f, 1.0f, 3);
+    population->randomizeBiases(-1.0f, 1.0f, 3);
+
+    neuro::GeneticOptions options;
+    options.eliteCount = 3;
+    options.seed = 11;
+
+    neuro::GeneticTrainer trainer(population, options);
+    size_t allocations = 0;
+
+    for (int generation = 0; generation < 4; generation++) {
+      for (size_t i = 0; i < population->size(); i++) {
+        population->get(i).setFitness(distanceFitness(population->get(i).getNeuralNetwork()));
+      }
+
+      const size_t before = allocationCount;
+      trainer.evolve();
+
+      if (generation > 0) {
+        allocations += allocationCount - before;
+      }
+    }
+
+    std::vector<std::vector<neuro::layer_weight_t>> weights;
+
+    for (const auto& individual : *population) {
+      weights.push_back(individual->getNeuralNetwork().getAllWeights());
+    }
+
+    return std::make_pair(weights, allocations);
+  };
+
+  const auto [serial, allocations] = evolveWith(0);
+  const auto [parallel, parallelAllocations] = evolveWith(3);
+
+  CHECK(allocations == 0);
+  CHECK(parallelAllocations == 0);
+  CHECK(parallel == serial);
+
+  neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{});
+}
+
+TEST_CASE("GeneticTrainer - Steady-state evolution inserts children without generation barriers") {
+  auto runWith = [](const neuro::SteadyStateOptions& steadyOptions) {
+    auto population = std::make_shared<neuro::Population>(30, std::vector<int>{3, 5, 2});
+    population->randomizeWeights(-1.0f, 1.0f, 4);
+    population->randomizeBiases(-1.0f, 1.0f, 4);
+    population->evaluateFitness(distanceFitness);
+
+    neuro::GeneticOptions options;
+    options.seed = 21;
+
+    neuro::GeneticTrainer trainer(population, options);
+
+    const float initialBest = population->getBestIndividual().getFitness();
+    const std::vector<float> initial = population->getFitnesses();
+    const size_t inserted = trainer.evolveSteadyState(400, distanceFitness, steadyOptions);
+
+    CHECK(inserted > 0);
+    CHECK(inserted <= 400);
+    CHECK(trainer.getGeneration() == 1);
+    CHECK(population->size() == 30);
+    CHECK(population->getBestIndividual().getFitness() >= initialBest);
+
+    const std::vector<float> final = population->getFitnesses();
+    CHECK(std::accumulate(final.begin(), final.end(), 0.0f) > std::accumulate(initial.begin(), initial.end(), 0.0f));
+
+    for (const auto& individual : *population) {
+      CHECK(individual->isFitnessCurrent());
+      CHECK(individual->getFitness() == distanceFitness(individual->getNeuralNetwork()));
+    }
+
+    return population->getFitnesses();
+  };
+
+  runWith(neuro::SteadyStateOptions{});
+
+  const neuro::SteadyStateOptions serial{neuro::ReplacementKind::Tournament, 4, 1};
+
+  CHECK(runWith(serial) == runWith(serial));
+}
+
+TEST_CASE("GeneticTrainer - Worst replacement keeps the fittest of parents and children") {
+  auto population = std::make_shared<neuro::Population>(24, std::vector<int>{3, 4, 2});
+  population->randomizeWeights(-1.0f, 1.0f, 4);
+  population->randomizeBiases(-1.0f, 1.0f, 4);
+  population->evaluateFitness(distanceFitness);
+
+  neuro::GeneticOptions options;
+  options.seed = 5;
+
+  neuro::GeneticTrainer trainer(population, options);
+
+  std::vector<float> seen = population->getFitnesses();
+  std::mutex seenLock;
+
+  const auto recordingFitness = [&](const neuro::INeuralNetwork& network) {
+    const float fitness = distanceFitness(network);
+
+    std::lock_guard<std::mutex> lock(seenLock);
+    seen.push_back(fitness);
+
+    return fitness;
+  };
+
+  // Whatever the order workers finish in, replacing the current worst leaves exactly the best 24 scores seen.
+  for (int round = 0; round < 3; round++) {
+    trainer.evolveSteadyState(200, recordingFitness, neuro::SteadyStateOptions{neuro::ReplacementKind::Worst, 3, 4});
+
+    std::vector<float> kept = population->getFitnesses();
+    std::sort(kept.begin(), kept.end(), std::greater<>());
+    std::sort(seen.begin(), seen.end(), std::greater<>());
+
+    CHECK(kept == std::vector<float>(seen.begin(), seen.begin() + 24));
+  }
+}
+
+TEST_CASE("GeneticTrainer - Steady-state evolution honours evaluation budgets") {
+  auto population = std::make_shared<neuro::Population>(20, std::vector<int>{3, 4, 2});
+  population->randomizeWeights(-1.0f, 1.0f, 4);
+  population->randomizeBiases(-1.0f, 1.0f, 4);
+  population->evaluateFitness(distanceFitness);
+
+  neuro::GeneticOptions options;
+  options.seed = 13;
+
+  neuro::GeneticTrainer trainer(population, options);
+
+  neuro::EvaluationCounters counters;
+  neuro::CancellationSource cancellation;
+
+  neuro::SteadyStateOptions steadyOptions;
+  steadyOptions.evaluation.stepLimit = 20;
+  steadyOptions.evaluation.counters = &counters;
+  steadyOptions.evaluation.cancellation = &cancellation;
+
+  // Children whose first weight is positive never end their episode; they would otherwise score best.
+  const auto episode = [](const neuro::INeuralNetwork& network, neuro::EvaluationToken& token) {
+    if ((*network.begin())->getWeights()[0][0] > 0.0f) {
+      while (token.step()) {}
+
+      return 0.0f;
+    }
+
+    return distanceFitness(network);
+  };
+
+  SUBCASE("Children that run out of budget are counted and never inserted") {
+    const size_t inserted = trainer.evolveSteadyState(200, episode, steadyOptions);
+
+    CHECK(counters.total() == 200);
+    CHECK(counters.timedOut > 0);
+    CHECK(counters.cancelled == 0);
+    CHECK(inserted <= counters.completed);
+
+    for (const auto& individual : *population) {
+      CHECK(individual->isFitnessCurrent());
+      CHECK(individual->getFitness() == distanceFitness(individual->getNeuralNetwork()));
+    }
+  }
+
+  SUBCASE("Cancelled runs breed no more children") {
+    counters.reset();
+    cancellation.cancel();
+
+    const std::vector<float> before = population->getFitnesses();
+
+    CHECK(trainer.evolveSteadyState(50, episode, steadyOptions) == 0);
+    CHECK(counters.cancelled == 50);
+    CHECK(population->getFitnesses() == before);
+  }
+}
@@ -0,0 +1,156 @@
+#include "neuro/strategies/island_trainer.hpp"
+
+#include <doctest/doctest.h>
+
+#include <memory>
+#include <vector>
+
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+#include "neuro/impl/population.hpp"
+#include "neuro/makers/activation.hpp"
+#include "neuro/utils/thread_pool.hpp"
+
+namespace {
+
+  std::vector<std::shared_ptr<neuro::Population>> makeIslands(size_t count, size_t size) {
+    std::vector<std::shared_ptr<neuro::Population>> islands;
+
+    for (size_t i = 0; i < count; i++) {
+      islands.push_back(std::make_shared<neuro::Population>(size, std::vector<int>{2, 3, 1}, neuro::maker::activationSigmoid()));
+      islands.back()->randomizeWeights(-1.0f, 1.0f, i + 1);
+      islands.back()->randomizeBiases(-1.0f, 1.0f, i + 1);
+    }
+
+    return islands;
+  }
+
+  float xorFitness(const neuro::INeuralNetwork& network) {
+    float error = 0.0f;
+
+    for (int a = 0; a < 2; a++) {
+      for (int b = 0; b < 2; b++) {
+        const float output = network.feedforward({static_cast<float>(a), static_cast<float>(b)})[0];
+        error += (output - static_cast<float>(a ^ b)) * (output - static_cast<float>(a ^ b));
+      }
+    }
+
+    return -error;
+  }
+
+} // namespace
+
+TEST_CASE("IslandTrainer - Islands evolve concurrently and improve") {
+  auto islands = makeIslands(4, 24);
+
+  // Without elites the best fitness can drop, so improving it is the work of selection alone.
+  neuro::IslandOptions options;
+  options.genetic.seed = 3;
+  options.genetic.eliteCount = 0;
+  options.migrationInterval = 5;
+
+  neuro::IslandTrainer trainer(islands, options);
+
+  auto meanFitness = [&]() {
+    float total = 0.0f;
+
+    for (const auto& island : islands) {
+      for (float fitness : island->getFitnesses()) {
+        total += fitness;
+      }
+    }
+
+    return total / (4 * 24);
+  };
+
+  for (auto& island : islands) {
+    island->evaluateFitness(xorFitness);
+  }
+
+  const float initialBest = trainer.getBestIndividual().getFitness();
+  const float initialMean = meanFitness();
+
+  trainer.run(41, xorFitness);
+
+  CHECK(trainer.getGeneration() == 41);
+  CHECK(trainer.getBestIndividual().getFitness() > initialBest);
+  CHECK(meanFitness() > initialMean);
+  CHECK(trainer.sentMigrants() + trainer.droppedMigrants() == 4 * 8 * options.migrants);
+
+  for (const auto& island : islands) {
+    CHECK(island->size() == 24);
+  }
+
+  CHECK_THROWS_AS(neuro::IslandTrainer({}, options), neuro::exception::InvalidNetworkArchitectureException);
+}
+
+TEST_CASE("IslandTrainer - Migrants carry the fittest genomes to other islands") {
+  for (auto topology : {neuro::MigrationTopology::Ring, neuro::MigrationTopology::FullyConnected, neuro::MigrationTopology::Random}) {
+    auto islands = makeIslands(2, 10);
+
+    // Without mutation, island 0 can only reach a first weight of 5 through migration.
+    for (size_t i = 0; i < 2; i++) {
+      for (auto& individual : *islands[i]) {
+        individual->getNeuralNetwork().layer(0).setWeight(0, 0, i == 0 ? -5.0f : 5.0f);
+      }
+    }
+
+    neuro::IslandOptions options;
+    options.genetic.rate = 0.0f;
+    options.genetic.eliteCount = 1;
+    options.topology = topology;
+    options.migrationInterval = 1;
+    options.migrants = 3;
+
+    neuro::IslandTrainer trainer(islands, options);
+
+    // Islands do not wait for each other, so island 0 may finish a whole run before island 1 sends anything;
+    // across runs the migrants are always waiting in its inbox.
+    for (int run = 0; run < 4; run++) {
+      trainer.run(1, [](const neuro::INeuralNetwork& network) { return network.layer(0).getWeight(0, 0); });
+    }
+
+    CHECK(islands[0]->getBestIndividual().getFitness() == 5.0f);
+  }
+}
+
+TEST_CASE("IslandTrainer - Ring migration delivers the best genome to the next island") {
+  // With a serial pool islands run one after the other, so island 0 has sent before island 1 migrates.
+  neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{0});
+
+  auto islands = makeIslands(3, 8);
+  islands[0]->get(3).getNeuralNetwork().layer(0).setWeight(0, 0, 100.0f);
+
+  const auto genome = islands[0]->get(3).getNeuralNetwork().getAllWeights();
+  // Peaks at the planted weight, so no descendant can outrank the planted genome.
+  const auto fitness = [](const neuro::INeuralNetwork& network) {
+    const float distance = network.layer(0).getWeight(0, 0) - 100.0f;
+    return -distance * distance;
+  };
+
+  neuro::IslandOptions options;
+  options.genetic.seed = 9;
+  options.genetic.eliteCount = 2;
+  options.topology = neuro::MigrationTopology::Ring;
+  options.migrationInterval = 3;
+  options.migrants = 1;
+
+  neuro::IslandTrainer trainer(islands, options);
+  trainer.run(options.migrationInterval, fitness);
+
+  auto holds = [&](const neuro::Population& island) {
+    for (const auto& individual : island) {
+      if (individual->getNeuralNetwork().getAllWeights() == genome) {
+        return true;
+      }
+    }
+
+    return false;
+  };
+
+  CHECK(holds(*islands[0]));
+  CHECK(holds(*islands[1]));
+  CHECK_FALSE(holds(*islands[2]));
+  CHECK(trainer.sentMigrants() == 3);
+
+  neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{});
+}
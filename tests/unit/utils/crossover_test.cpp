@@ -0,0 +1,111 @@
+#include "neuro/utils/crossover.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "neuro/utils/random.hpp"
+#include "neuro/utils/simd.hpp"
+
+namespace {
+
+  const std::vector<float> FIRST(1000, 1.0f);
+  const std::vector<float> SECOND(1000, 3.0f);
+
+  std::vector<float> recombine(const neuro::CrossoverOptions& options, const std::vector<size_t>& segments) {
+    neuro::RandomStream random(8, 0, 0, 0);
+    neuro::Crossover crossover(options, FIRST.size(), random);
+
+    std::vector<float> child(FIRST.size());
+    size_t offset = 0;
+
+    for (size_t segment : segments) {
+      crossover.apply(FIRST.data() + offset, SECOND.data() + offset, segment, child.data() + offset);
+      offset += segment;
+    }
+
+    return child;
+  }
+
+  size_t switches(const std::vector<float>& child) {
+    size_t count = 0;
+
+    for (size_t i = 1; i < child.size(); i++) {
+      count += child[i] != child[i - 1];
+    }
+
+    return count;
+  }
+
+} // namespace
+
+TEST_CASE("Crossover - Point crossovers cut the genome at the same positions however it is split") {
+  neuro::CrossoverOptions options;
+  options.kind = neuro::CrossoverKind::MultiPoint;
+  options.points = 4;
+
+  const auto whole = recombine(options, {1000});
+
+  CHECK(recombine(options, {3, 250, 97, 650}) == whole);
+  CHECK(whole.front() == 1.0f);
+  CHECK(switches(whole) <= 4);
+  CHECK(std::all_of(whole.begin(), whole.end(), [](float value) { return value == 1.0f || value == 3.0f; }));
+
+  options.kind = neuro::CrossoverKind::SinglePoint;
+
+  const auto single = recombine(options, {1000});
+
+  CHECK(switches(single) == 1);
+  CHECK(single.back() == 3.0f);
+}
+
+TEST_CASE("Crossover - Uniform selection is identical at every SIMD level") {
+  const auto detected = neuro::getSimdLevel();
+  neuro::CrossoverOptions options;
+
+  neuro::setSimdLevel(neuro::SimdLevel::Scalar);
+  const auto expected = recombine(options, {7, 993});
+
+  const size_t fromSecond = std::count(expected.begin(), expected.end(), 3.0f);
+
+  CHECK(fromSecond > 430);
+  CHECK(fromSecond < 570);
+  CHECK(recombine(options, {1000}) == expected);
+  CHECK(recombine(options, {33, 1, 31, 935}) == expected);
+
+  for (auto level : {neuro::SimdLevel::SSE2, neuro::SimdLevel::AVX2, neuro::SimdLevel::AVX512}) {
+    neuro::setSimdLevel(level);
+
+    CHECK(recombine(options, {7, 993}) == expected);
+  }
+
+  neuro::setSimdLevel(detected);
+}
+
+TEST_CASE("Crossover - Blend and SBX stay around the parents") {
+  neuro::CrossoverOptions options;
+  options.kind = neuro::CrossoverKind::Blend;
+
+  const auto blended = recombine(options, {500, 500});
+
+  CHECK(blended[0] >= 1.0f);
+  CHECK(blended[0] <= 3.0f);
+  CHECK(std::all_of(blended.begin(), blended.end(), [&](float value) { return value == blended[0]; }));
+
+  options.kind = neuro::CrossoverKind::SimulatedBinary;
+
+  const auto sbx = recombine(options, {1000});
+
+  // Each SBX child spreads around its own parent, symmetrically to the sibling that is not produced.
+  double sum = 0.0;
+  size_t near = 0;
+
+  for (float value : sbx) {
+    sum += value;
+    near += value > 0.5f && value < 1.5f;
+  }
+
+  CHECK(sum / sbx.size() == doctest::Approx(1.0).epsilon(0.1));
+  CHECK(near > 950);
+}
@@ -0,0 +1,84 @@
+#include "neuro/utils/evaluation_budget.hpp"
+
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <thread>
+
+TEST_CASE("EvaluationToken - Step and time limits") {
+  neuro::EvaluationToken unlimited;
+
+  for (int i = 0; i < 1000; i++) {
+    CHECK(unlimited.step());
+  }
+
+  CHECK_FALSE(unlimited.shouldStop());
+  CHECK(unlimited.finish() == neuro::EvaluationOutcome::Completed);
+
+  neuro::EvaluationToken steps(std::chrono::nanoseconds{0}, 5);
+  size_t taken = 0;
+
+  while (steps.step()) {
+    taken++;
+  }
+
+  CHECK(taken == 5);
+  CHECK(steps.outcome() == neuro::EvaluationOutcome::TimedOut);
+  CHECK_FALSE(steps.step());
+
+  steps.arm(std::chrono::nanoseconds{0}, 5);
+  CHECK(steps.steps() == 0);
+  CHECK(steps.step(5));
+  CHECK(steps.finish() == neuro::EvaluationOutcome::Completed);
+
+  neuro::EvaluationToken deadline(std::chrono::milliseconds{1}, 0);
+  std::this_thread::sleep_for(std::chrono::milliseconds{3});
+
+  CHECK(deadline.shouldStop());
+  CHECK(deadline.outcome() == neuro::EvaluationOutcome::TimedOut);
+
+  deadline.arm(std::chrono::milliseconds{1}, 0);
+
+  while (deadline.step()) {
+  }
+
+  CHECK(deadline.outcome() == neuro::EvaluationOutcome::TimedOut);
+
+  // Functions that never look at their token are caught once they return.
+  deadline.arm(std::chrono::milliseconds{1}, 0);
+  std::this_thread::sleep_for(std::chrono::milliseconds{3});
+
+  CHECK(deadline.finish() == neuro::EvaluationOutcome::TimedOut);
+}
+
+TEST_CASE("EvaluationToken - Cancellation and counters") {
+  neuro::CancellationSource source;
+  neuro::EvaluationToken token(std::chrono::nanoseconds{0}, 0, &source);
+
+  CHECK(token.step());
+
+  source.cancel();
+
+  CHECK_FALSE(token.step());
+  CHECK(token.outcome() == neuro::EvaluationOutcome::Cancelled);
+
+  source.reset();
+  token.arm(std::chrono::nanoseconds{0}, 0, &source);
+
+  CHECK(token.step());
+  CHECK_FALSE(token.shouldStop());
+
+  neuro::EvaluationCounters counters;
+  counters.record(neuro::EvaluationOutcome::Completed);
+  counters.record(neuro::EvaluationOutcome::Completed);
+  counters.record(neuro::EvaluationOutcome::TimedOut);
+  counters.record(neuro::EvaluationOutcome::Cancelled);
+
+  CHECK(counters.completed == 2);
+  CHECK(counters.timedOut == 1);
+  CHECK(counters.cancelled == 1);
+  CHECK(counters.total() == 4);
+
+  counters.reset();
+  CHECK(counters.total() == 0);
+}
@@ -0,0 +1,78 @@
+#include "neuro/utils/handoff_queue.hpp"
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST_CASE("HandoffQueue - Bounded FIFO") {
+  neuro::HandoffQueue<std::unique_ptr<int>> queue(3);
+
+  CHECK(queue.capacity() == 4);
+
+  for (int i = 0; i < 4; i++) {
+    CHECK(queue.tryPush(std::make_unique<int>(i)));
+  }
+
+  auto rejected = std::make_unique<int>(9);
+  CHECK_FALSE(queue.tryPush(std::move(rejected)));
+  CHECK(rejected != nullptr);
+
+  std::unique_ptr<int> value;
+
+  for (int i = 0; i < 4; i++) {
+    REQUIRE(queue.tryPop(value));
+    CHECK(*value == i);
+  }
+
+  CHECK_FALSE(queue.tryPop(value));
+}
+
+TEST_CASE("HandoffQueue - Concurrent producers and consumers hand over every value once") {
+  neuro::HandoffQueue<size_t> queue(64);
+
+  const size_t producers = 4;
+  const size_t perProducer = 20000;
+
+  std::atomic<size_t> total{0};
+  std::atomic<size_t> received{0};
+  std::vector<std::thread> threads;
+
+  for (size_t p = 0; p < producers; p++) {
+    threads.emplace_back([&, p]() {
+      for (size_t i = 0; i < perProducer; i++) {
+        size_t value = p * perProducer + i + 1;
+
+        while (!queue.tryPush(std::move(value))) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  for (size_t c = 0; c < 2; c++) {
+    threads.emplace_back([&]() {
+      size_t value;
+
+      while (received.load() < producers * perProducer) {
+        if (queue.tryPop(value)) {
+          total += value;
+          received++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const size_t count = producers * perProducer;
+
+  CHECK(received == count);
+  CHECK(total == count * (count + 1) / 2);
+}
@@ -0,0 +1,135 @@
+#include "neuro/utils/random.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "neuro/utils/simd.hpp"
+
+TEST_CASE("Random - Philox4x32-10 matches the reference known-answer vectors") {
+  using block_t = std::array<uint32_t, 4>;
+
+  CHECK(neuro::RandomStream::philox({0, 0, 0, 0}, {0, 0}) == block_t{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+  CHECK(neuro::RandomStream::philox({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+        block_t{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+  CHECK(neuro::RandomStream::philox({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+        block_t{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("Random - Streams are reproducible and independent per coordinate") {
+  neuro::RandomStream first(42, 3, 7, 1);
+  neuro::RandomStream second(neuro::RandomKey{42, 3, 7}, 1);
+  neuro::RandomStream otherLayer(42, 3, 7, 2);
+
+  size_t equalToOtherLayer = 0;
+
+  for (int i = 0; i < 1000; i++) {
+    const uint32_t value = first();
+
+    CHECK(value == second());
+    equalToOtherLayer += value == otherLayer();
+  }
+
+  CHECK(equalToOtherLayer < 2);
+}
+
+TEST_CASE("Random - Uniform and normal draws have the expected range and moments") {
+  neuro::RandomStream random(7, 0, 0, 0);
+
+  double sum = 0.0;
+  double squares = 0.0;
+  bool inRange = true;
+
+  for (int i = 0; i < 20000; i++) {
+    const float value = random.uniform(-2.0f, 3.0f);
+    inRange = inRange && value >= -2.0f && value < 3.0f;
+
+    const float normal = random.normal(1.0f, 2.0f);
+    sum += normal;
+    squares += normal * normal;
+  }
+
+  const double mean = sum / 20000;
+
+  CHECK(inRange);
+  CHECK(mean == doctest::Approx(1.0).epsilon(0.05));
+  CHECK(std::sqrt(squares / 20000 - mean * mean) == doctest::Approx(2.0).epsilon(0.05));
+}
+
+TEST_CASE("Random - Bulk fills reproduce the scalar sequence at every SIMD level") {
+  const auto detected = neuro::getSimdLevel();
+
+  for (auto level : {neuro::SimdLevel::Scalar, neuro::SimdLevel::SSE2, neuro::SimdLevel::AVX2, neuro::SimdLevel::AVX512}) {
+    neuro::setSimdLevel(level);
+
+    neuro::RandomStream scalar(99, 1, 2, 3);
+    neuro::RandomStream bulk(99, 1, 2, 3);
+
+    // Odd sizes leave partial blocks behind so the next fill has to drain them first.
+    for (size_t size : {3, 130, 1, 517}) {
+      std::vector<uint32_t> bits(size);
+      bulk.fill(bits.data(), size);
+
+      bool equal = true;
+
+      for (uint32_t value : bits) {
+        equal = equal && value == scalar();
+      }
+
+      CHECK(equal);
+    }
+
+    std::vector<float> values(301);
+    bulk.fillUniform(values.data(), values.size(), -0.5f, 2.0f);
+
+    bool equal = true;
+
+    for (float value : values) {
+      equal = equal && value == scalar.uniform(-0.5f, 2.0f);
+    }
+
+    CHECK(equal);
+  }
+
+  neuro::setSimdLevel(detected);
+}
+
+TEST_CASE("Random - Bulk normal fill is reproducible and has the expected moments") {
+  neuro::RandomStream first(5, 0, 0, 0);
+  neuro::RandomStream second(5, 0, 0, 0);
+
+  std::vector<float> values(20001);
+  first.fillNormal(values.data(), values.size(), 1.0f, 2.0f);
+
+  std::vector<float> split(values.size());
+  second.fillNormal(split.data(), 7, 1.0f, 2.0f);
+  second.fillNormal(split.data() + 7, split.size() - 7, 1.0f, 2.0f);
+
+  CHECK(values == split);
+
+  double sum = 0.0;
+  double squares = 0.0;
+
+  for (float value : values) {
+    sum += value;
+    squares += value * value;
+  }
+
+  const double mean = sum / values.size();
+
+  CHECK(mean == doctest::Approx(1.0).epsilon(0.05));
+  CHECK(std::sqrt(squares / values.size() - mean * mean) == doctest::Approx(2.0).epsilon(0.05));
+}
+
+TEST_CASE("Random - Thread-local streams restart with the global seed") {
+  neuro::setGlobalSeed(1234);
+  const uint32_t first = neuro::RandomStream::local()();
+
+  neuro::setGlobalSeed(1234);
+
+  CHECK(neuro::RandomStream::local()() == first);
+  CHECK(neuro::globalSeed() == 1234);
+}
@@ -0,0 +1,141 @@
+#include "neuro/utils/selection.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "neuro/utils/evaluation_budget.hpp"
+#include "neuro/utils/random.hpp"
+
+namespace {
+
+  std::vector<float> sampleFitness(size_t size) {
+    neuro::RandomStream random(3, 0, 0, 0);
+    std::vector<float> fitness(size);
+
+    for (auto& value : fitness) {
+      // Coarse values so ties are common.
+      value = static_cast<float>(static_cast<int>(random.uniform(0.0f, 50.0f)));
+    }
+
+    return fitness;
+  }
+
+} // namespace
+
+TEST_CASE("Selection - topK matches a full sort") {
+  const auto fitness = sampleFitness(1000);
+
+  std::vector<size_t> sorted(fitness.size());
+  std::iota(sorted.begin(), sorted.end(), 0);
+  std::stable_sort(sorted.begin(), sorted.end(), [&](size_t a, size_t b) { return fitness[a] > fitness[b]; });
+
+  for (size_t k : {0, 1, 7, 100, 1000, 5000}) {
+    const auto top = neuro::topK(fitness, k);
+
+    REQUIRE(top.size() == std::min<size_t>(k, fitness.size()));
+    CHECK(std::equal(top.begin(), top.end(), sorted.begin()));
+  }
+
+  std::vector<size_t> indices;
+  neuro::selectTop(fitness.data(), fitness.size(), 10, indices);
+
+  CHECK(indices.size() == fitness.size());
+  CHECK(std::is_permutation(indices.begin(), indices.end(), sorted.begin()));
+}
+
+TEST_CASE("Selection - Tournament picks the fittest contestant") {
+  const std::vector<float> fitness = {1.0f, 5.0f, 3.0f, 5.0f};
+  neuro::RandomStream random(1, 0, 0, 0);
+
+  std::vector<size_t> counts(fitness.size());
+
+  for (int i = 0; i < 4000; i++) {
+    counts[neuro::tournamentSelect(fitness.data(), fitness.size(), 1, random)]++;
+  }
+
+  for (size_t count : counts) {
+    CHECK(count > 800);
+  }
+
+  // A large tournament almost surely sees index 1, which wins the tie against index 3.
+  CHECK(neuro::tournamentSelect(fitness.data(), fitness.size(), 64, random) == 1);
+}
+
+TEST_CASE("Selection - Alias tables sample in proportion to their weights") {
+  const std::vector<float> weights = {1.0f, 0.0f, 3.0f, 4.0f, 2.0f};
+  const neuro::AliasTable table(weights);
+  neuro::RandomStream random(2, 0, 0, 0);
+
+  const int draws = 100000;
+  std::vector<int> counts(weights.size());
+
+  for (int i = 0; i < draws; i++) {
+    counts[table.sample(random)]++;
+  }
+
+  CHECK(counts[1] == 0);
+
+  for (size_t i = 0; i < weights.size(); i++) {
+    CHECK(static_cast<float>(counts[i]) / draws == doctest::Approx(weights[i] / 10.0f).epsilon(0.05));
+  }
+
+  neuro::AliasTable uniform(std::vector<float>(4, 0.0f));
+
+  CHECK(uniform.size() == 4);
+  CHECK(uniform.sample(random) < 4);
+}
+
+TEST_CASE("Selection - Rank and roulette selectors") {
+  const std::vector<float> fitness = {-2.0f, 0.0f, 2.0f};
+  neuro::RandomStream random(4, 0, 0, 0);
+  neuro::Selector selector;
+
+  const int draws = 60000;
+
+  selector.prepare(neuro::SelectionKind::Roulette, fitness.data(), fitness.size(), 3, 1.5f);
+  std::vector<int> counts(fitness.size());
+
+  for (int i = 0; i < draws; i++) {
+    counts[selector(random)]++;
+  }
+
+  CHECK(counts[0] == 0);
+  CHECK(static_cast<float>(counts[2]) / draws == doctest::Approx(2.0f / 3.0f).epsilon(0.05));
+
+  selector.prepare(neuro::SelectionKind::Rank, fitness.data(), fitness.size(), 3, 2.0f);
+  std::fill(counts.begin(), counts.end(), 0);
+
+  for (int i = 0; i < draws; i++) {
+    counts[selector(random)]++;
+  }
+
+  // Linear ranking with pressure 2 weights the ranks 2, 1 and 0.
+  CHECK(counts[0] == 0);
+  CHECK(static_cast<float>(counts[1]) / draws == doctest::Approx(1.0f / 3.0f).epsilon(0.05));
+}
+
+TEST_CASE("Selection - Roulette ignores timed-out and non-finite fitness") {
+  const std::vector<float> fitness = {
+    neuro::TIMEOUT_FITNESS, 1.0f, -std::numeric_limits<float>::infinity(), 3.0f, std::nanf(""), 2.0f, -std::numeric_limits<float>::max(),
+  };
+
+  neuro::RandomStream random(5, 0, 0, 0);
+  neuro::Selector selector;
+  selector.prepare(neuro::SelectionKind::Roulette, fitness.data(), fitness.size(), 3, 1.5f);
+
+  const int draws = 60000;
+  std::vector<int> counts(fitness.size());
+
+  for (int i = 0; i < draws; i++) {
+    counts[selector(random)]++;
+  }
+
+  // The weights are measured from the lowest real score, 1, so they are 0, 2 and 1.
+  CHECK(counts[0] + counts[1] + counts[2] + counts[4] + counts[6] == 0);
+  CHECK(static_cast<float>(counts[3]) / draws == doctest::Approx(2.0f / 3.0f).epsilon(0.05));
+}
@@ -0,0 +1,136 @@
+#include "neuro/utils/simd.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cfloat>
+#include <cmath>
+#include <random>
+
+#include "neuro/impl/dense_layer.hpp"
+#include "neuro/impl/neural_network.hpp"
+#include "neuro/makers/activation.hpp"
+#include "neuro/types.hpp"
+
+namespace {
+
+  neuro::NeuralNetwork makeStaticNetwork() {
+    neuro::NeuralNetwork network({3, 4, 2}, neuro::maker::activationSigmoid());
+    network.randomizeWeights(-1.0f, 1.0f, neuro::RandomKey{5, 0, 0});
+
+    return network;
+  }
+
+  // Built during static initialisation, possibly before simd.cpp's own globals would have been.
+  const neuro::NeuralNetwork staticNetwork = makeStaticNetwork();
+  const neuro::neuro_layer_t staticOutput = staticNetwork.feedforward({0.5f, -0.25f, 1.0f});
+
+} // namespace
+
+TEST_CASE("SIMD - Kernels are usable during static initialisation") {
+  const auto network = makeStaticNetwork();
+
+  CHECK(network.getAllWeights() == staticNetwork.getAllWeights());
+  CHECK(network.feedforward({0.5f, -0.25f, 1.0f}) == staticOutput);
+}
+
+TEST_CASE("SIMD - Level selection is clamped to the detected CPU support") {
+  const auto detected = neuro::detectSimdLevel();
+
+  neuro::setSimdLevel(neuro::SimdLevel::AVX512);
+
+  CHECK(neuro::getSimdLevel() == detected);
+
+  neuro::setSimdLevel(neuro::SimdLevel::Scalar);
+
+  CHECK(neuro::getSimdLevel() == neuro::SimdLevel::Scalar);
+
+  neuro::setSimdLevel(detected);
+}
+
+TEST_CASE("SIMD - DenseLayer batched feedforward matches the scalar path on every level") {
+  const auto detected = neuro::detectSimdLevel();
+
+  for (size_t outputs : {1, 2, 5, 8}) {
+    for (size_t inputs : {1, 3, 8, 19, 40}) {
+      for (size_t batchSize : {1, 4, 6, 13}) {
+        neuro::DenseLayer layer(inputs, outputs, neuro::maker::activationIdentity());
+
+        layer.randomizeWeights(-1.0f, 1.0f);
+        layer.randomizeBiases(-1.0f, 1.0f);
+
+        neuro::neuro_layer_t batch(batchSize * inputs);
+
+        for (size_t i = 0; i < batch.size(); i++) {
+          batch[i] = std::sin(static_cast<float>(i));
+        }
+
+        neuro::setSimdLevel(neuro::SimdLevel::Scalar);
+        const auto expected = layer.feedforwardBatch(batch, batchSize);
+
+        for (auto level : {neuro::SimdLevel::SSE2, neuro::SimdLevel::AVX2, neuro::SimdLevel::AVX512}) {
+          if (level > detected) {
+            continue;
+          }
+
+          neuro::setSimdLevel(level);
+          const auto output = layer.feedforwardBatch(batch, batchSize);
+
+          REQUIRE(output.size() == expected.size());
+
+          for (size_t i = 0; i < output.size(); i++) {
+            CHECK(output[i] == doctest::Approx(expected[i]).epsilon(1e-5).scale(static_cast<double>(inputs)));
+          }
+        }
+      }
+    }
+  }
+
+  neuro::setSimdLevel(detected);
+}
+
+TEST_CASE("SIMD - DenseLayer feedforward matches the scalar path on every level") {
+  const auto detected = neuro::detectSimdLevel();
+  std::mt19937 engine(42);
+
+  for (size_t outputs : {1, 3, 4, 7, 17}) {
+    for (size_t inputs : {1, 2, 7, 8, 15, 16, 17, 33, 70}) {
+      neuro::DenseLayer layer(inputs, outputs, neuro::maker::activationIdentity());
+
+      layer.randomizeWeights(-1.0f, 1.0f);
+      layer.randomizeBiases(-1.0f, 1.0f);
+
+      std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+      neuro::neuro_layer_t input(inputs);
+
+      for (auto& value : input) {
+        value = dist(engine);
+      }
+
+      neuro::setSimdLevel(neuro::SimdLevel::Scalar);
+      const auto expected = layer.feedforward(input);
+
+      for (auto level : {neuro::SimdLevel::SSE2, neuro::SimdLevel::AVX2, neuro::SimdLevel::AVX512}) {
+        if (level > detected) {
+          continue;
+        }
+
+        neuro::setSimdLevel(level);
+        const auto output = layer.feedforward(input);
+
+        REQUIRE(output.size() == expected.size());
+
+        for (size_t i = 0; i < outputs; i++) {
+          float magnitude = std::fabs(layer.getBias(i));
+
+          for (size_t j = 0; j < inputs; j++) {
+            magnitude += std::fabs(layer.getWeight(i, j) * input[j]);
+          }
+
+          CHECK(std::fabs(output[i] - expected[i]) <= (inputs + 1) * FLT_EPSILON * magnitude);
+        }
+      }
+    }
+  }
+
+  neuro::setSimdLevel(detected);
+}
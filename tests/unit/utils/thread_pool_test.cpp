@@ -0,0 +1,75 @@
+#include "neuro/utils/thread_pool.hpp"
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("ThreadPool - parallelFor covers the range exactly once") {
+  neuro::ThreadPool pool(3);
+
+  CHECK(pool.size() == 3);
+
+  for (size_t count : {0, 1, 7, 64, 1000}) {
+    std::vector<std::atomic<int>> visits(count);
+    std::atomic<size_t> misaligned{0};
+
+    pool.parallelFor(count, 4, [&](size_t begin, size_t end) {
+      if (begin % 4 != 0) {
+        misaligned++;
+      }
+
+      for (size_t i = begin; i < end; i++) {
+        visits[i]++;
+      }
+    });
+
+    size_t once = 0;
+
+    for (auto& visit : visits) {
+      once += visit.load() == 1;
+    }
+
+    CHECK(once == count);
+    CHECK(misaligned == 0);
+  }
+}
+
+TEST_CASE("ThreadPool - Nested calls complete and exceptions propagate") {
+  neuro::ThreadPool pool(2);
+  std::atomic<size_t> total{0};
+
+  pool.parallelFor(6, 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      pool.parallelFor(10, 1, [&](size_t innerBegin, size_t innerEnd) { total += innerEnd - innerBegin; });
+    }
+  });
+
+  CHECK(total == 60);
+
+  CHECK_THROWS_AS(pool.parallelFor(100, 1,
+                                   [](size_t begin, size_t) {
+                                     if (begin > 0) {
+                                       throw std::runtime_error("chunk failed");
+                                     }
+                                   }),
+                  std::runtime_error);
+}
+
+TEST_CASE("ThreadPool - Global pool is configurable and shared") {
+  neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{2, true});
+
+  CHECK(neuro::ThreadPool::global().size() == 2);
+  CHECK(neuro::ThreadPool::global().concurrency() == 3);
+
+  std::atomic<size_t> total{0};
+
+  neuro::ThreadPool::global().parallelFor(10000, 16, [&](size_t begin, size_t end) { total += end - begin; });
+
+  CHECK(total == 10000);
+
+  neuro::ThreadPool::configureGlobal(neuro::ThreadPoolOptions{});
+
+  CHECK(neuro::ThreadPool::global().size() == neuro::ThreadPoolOptions{}.workers);
+}
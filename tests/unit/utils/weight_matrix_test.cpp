@@ -0,0 +1,107 @@
+#include "neuro/utils/weight_matrix.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "neuro/exceptions/invalid_network_architecture_exception.hpp"
+#include "neuro/types.hpp"
+
+TEST_CASE("WeightMatrix - Object construction tests") {
+  SUBCASE("Create WeightMatrix without parameters") {
+    neuro::WeightMatrix matrix;
+
+    CHECK(matrix.rows() == 0);
+    CHECK(matrix.cols() == 0);
+    CHECK(matrix.empty());
+  }
+
+  SUBCASE("Create WeightMatrix by specifying rows and columns") {
+    neuro::WeightMatrix matrix(3, 5);
+
+    CHECK(matrix.rows() == 3);
+    CHECK(matrix.cols() == 5);
+    CHECK(matrix.stride() >= matrix.cols());
+    CHECK(matrix.stride() % neuro::WeightMatrix::STRIDE_ALIGNMENT == 0);
+
+    for (const auto& row : matrix) {
+      for (float value : row) {
+        CHECK(value == 0.0f);
+      }
+    }
+  }
+
+  SUBCASE("Create WeightMatrix from nested values") {
+    neuro::WeightMatrix matrix = {{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    std::vector<std::vector<float>> nested = {{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+
+    CHECK(matrix.rows() == 2);
+    CHECK(matrix.cols() == 3);
+    CHECK(matrix[1][2] == 6.0f);
+    CHECK(matrix.toVector() == nested);
+    CHECK(neuro::WeightMatrix(nested) == matrix);
+  }
+
+  SUBCASE("Rows with different sizes are rejected") {
+    std::vector<std::vector<float>> nested = {{1.0f}, {1.0f, 2.0f}};
+
+    CHECK_THROWS_AS(neuro::WeightMatrix(nested), neuro::exception::InvalidNetworkArchitectureException);
+  }
+}
+
+TEST_CASE("WeightMatrix - Contiguous row-major storage") {
+  neuro::WeightMatrix matrix(4, 3);
+
+  CHECK(reinterpret_cast<std::uintptr_t>(matrix.data()) % neuro::DEFAULT_ALIGNMENT == 0);
+
+  for (size_t i = 0; i < matrix.rows(); i++) {
+    CHECK(matrix[i].data() == matrix.data() + i * matrix.stride());
+  }
+
+  matrix[2][1] = 7.0f;
+
+  CHECK(matrix.data()[2 * matrix.stride() + 1] == 7.0f);
+}
+
+TEST_CASE("WeightMatrix - Non-owning views") {
+  neuro::WeightMatrix matrix = {{1.0f, 2.0f}, {3.0f, 4.0f}};
+
+  neuro::layer_weight_view_t view = matrix.view();
+  neuro::layer_weight_const_view_t constView = view;
+
+  view[0][1] = 10.0f;
+
+  CHECK(matrix[0][1] == 10.0f);
+  CHECK(constView[0][1] == 10.0f);
+  CHECK(constView.rows() == 2);
+  CHECK(constView.cols() == 2);
+
+  size_t rows = 0;
+
+  for (const auto& row : constView) {
+    CHECK(row.size() == 2);
+    rows++;
+  }
+
+  CHECK(rows == 2);
+}
+
+TEST_CASE("WeightMatrix - Reshape and compare") {
+  neuro::WeightMatrix matrix = {{1.0f, 2.0f}, {3.0f, 4.0f}};
+  neuro::WeightMatrix other = {{1.0f, 2.0f}, {3.0f, 4.0f}};
+
+  CHECK(matrix == other);
+
+  other[1][1] = 0.0f;
+
+  CHECK(matrix != other);
+
+  matrix.reshape(3, 1);
+
+  CHECK(matrix == neuro::WeightMatrix({{0.0f}, {0.0f}, {0.0f}}));
+
+  matrix.fill(2.0f);
+
+  CHECK(matrix == neuro::WeightMatrix({{2.0f}, {2.0f}, {2.0f}}));
+}